@@ -1 +1,7 @@
+include(CMakeFindDependencyMacro)
+
 include("${CMAKE_CURRENT_LIST_DIR}/dragonboxTargets.cmake")
+
+if (TARGET dragonbox::dragonbox_parallel)
+  find_dependency(Threads)
+endif()
@@ -95,6 +95,75 @@
         #define JKJ_FAST_MUL64_DEFINED 1
     #endif
 
+    // Opt-in instrumentation of the main algorithm, both disabled by default and compiled out
+    // entirely when disabled. They should be defined consistently across all translation units,
+    // including the ones compiling dragonbox_to_chars.cpp and dragonbox_extern_templates.cpp.
+    //   - If JKJ_DRAGONBOX_ENABLE_STATS is defined to be 1, each thread counts how many times the
+    //   main algorithm takes each of its branches. The counters can be read through
+    //   dragonbox::stats::get() and cleared through dragonbox::stats::reset().
+    //   - If JKJ_DRAGONBOX_ENABLE_USDT_PROBES is defined to be 1, the same branch points are marked
+    //   with USDT probes (provider "dragonbox") through <sys/sdt.h>, which then can be attached to
+    //   by tools like bpftrace or perf without restarting the process.
+    #ifndef JKJ_DRAGONBOX_ENABLE_STATS
+        #define JKJ_DRAGONBOX_ENABLE_STATS 0
+    #else
+        #define JKJ_DRAGONBOX_ENABLE_STATS_DEFINED 1
+    #endif
+
+    #ifndef JKJ_DRAGONBOX_ENABLE_USDT_PROBES
+        #define JKJ_DRAGONBOX_ENABLE_USDT_PROBES 0
+    #else
+        #define JKJ_DRAGONBOX_ENABLE_USDT_PROBES_DEFINED 1
+    #endif
+
+    // If JKJ_DRAGONBOX_EXTERN_TEMPLATES is defined to be 1, the instances of the main algorithm used
+    // by to_decimal and to_chars_n with the default policies for float and double are declared
+    // extern, so that they are compiled only once in source/dragonbox_extern_templates.cpp rather
+    // than in every translation unit calling them. The program then needs to be linked against
+    // that file (the dragonbox_extern_templates library in CMake). to_decimal and to_chars_n
+    // themselves remain inline, so nothing changes for other policies or in constant evaluation.
+    #ifndef JKJ_DRAGONBOX_EXTERN_TEMPLATES
+        #define JKJ_DRAGONBOX_EXTERN_TEMPLATES 0
+    #else
+        #define JKJ_DRAGONBOX_EXTERN_TEMPLATES_DEFINED 1
+    #endif
+
+    // Static data members of class templates get a copy in every shared library using them unless
+    // they are exported, so a process may end up with several copies of the same cache table. If
+    // JKJ_DRAGONBOX_SHARED_TABLES is defined to be 1, the full and the compressed cache tables used
+    // by policy::cache::full and policy::cache::compact are instead read at runtime from extern
+    // declarations, which are defined only once in source/dragonbox_shared_tables.cpp (the
+    // dragonbox_shared_tables library in CMake) and do not depend on JKJ_NAMESPACE. The tables in
+    // this header are still used in constant evaluation. The declarations are decorated with
+    // JKJ_DRAGONBOX_TABLE_API, which the users may define into the attributes needed for exporting
+    // or importing them, e.g. __declspec(dllexport) and __declspec(dllimport).
+    #ifndef JKJ_DRAGONBOX_SHARED_TABLES
+        #define JKJ_DRAGONBOX_SHARED_TABLES 0
+    #else
+        #define JKJ_DRAGONBOX_SHARED_TABLES_DEFINED 1
+    #endif
+
+    #ifndef JKJ_DRAGONBOX_TABLE_API
+        #if defined(__GNUC__)
+            #define JKJ_DRAGONBOX_TABLE_API __attribute__((visibility("default")))
+        #else
+            #define JKJ_DRAGONBOX_TABLE_API
+        #endif
+    #else
+        #define JKJ_DRAGONBOX_TABLE_API_DEFINED 1
+    #endif
+
+    // If JKJ_DRAGONBOX_SPLIT_COLD_PATHS is defined to be 1, the paths taken only by rare inputs (the
+    // shorter interval case of the main algorithm, and zeros, infinities and NaNs in to_chars_n)
+    // are compiled into separate functions that are marked cold and never inlined, so that less
+    // code is inlined into each caller and the code for the common inputs is laid out compactly.
+    // The subnormal case only replaces the exponent, so its branch is just marked unlikely.
+    #ifndef JKJ_DRAGONBOX_SPLIT_COLD_PATHS
+        #define JKJ_DRAGONBOX_SPLIT_COLD_PATHS 0
+    #else
+        #define JKJ_DRAGONBOX_SPLIT_COLD_PATHS_DEFINED 1
+    #endif
+
     ////////////////////////////////////////////////////////////////////////////////////////
     // Language feature detections.
     ////////////////////////////////////////////////////////////////////////////////////////
@@ -248,6 +317,19 @@
         #define JKJ_FORCEINLINE inline
     #endif
 
+    // Functions on the rare paths and the branches leading to the common paths; see the
+    // description of JKJ_DRAGONBOX_SPLIT_COLD_PATHS above.
+    #if JKJ_DRAGONBOX_SPLIT_COLD_PATHS && (defined(__GNUC__) || defined(__clang__))
+        #define JKJ_COLD_PATH inline __attribute__((cold, noinline))
+        #define JKJ_LIKELY(x) __builtin_expect(!!(x), 1)
+    #elif JKJ_DRAGONBOX_SPLIT_COLD_PATHS && defined(_MSC_VER)
+        #define JKJ_COLD_PATH __declspec(noinline) inline
+        #define JKJ_LIKELY(x) (x)
+    #else
+        #define JKJ_COLD_PATH JKJ_FORCEINLINE
+        #define JKJ_LIKELY(x) (x)
+    #endif
+
     #if defined(__has_builtin)
         #define JKJ_HAS_BUILTIN(x) __has_builtin(x)
     #else
@@ -259,11 +341,62 @@
     #elif defined(__INTEL_COMPILER)
         #include <immintrin.h>
     #endif
+
+    // Instrumentation hooks; see the description of JKJ_DRAGONBOX_ENABLE_STATS above.
+    #if JKJ_DRAGONBOX_ENABLE_STATS
+        #define JKJ_DRAGONBOX_STATS_ADD(counter, n) detail::thread_local_stats().counter += (n)
+    #else
+        #define JKJ_DRAGONBOX_STATS_ADD(counter, n)
+    #endif
+
+    #if JKJ_DRAGONBOX_ENABLE_USDT_PROBES
+        #if defined(__has_include)
+            #if __has_include(<sys/sdt.h>)
+                #include <sys/sdt.h>
+            #else
+                #error "JKJ_DRAGONBOX_ENABLE_USDT_PROBES requires <sys/sdt.h>."
+            #endif
+        #else
+            #include <sys/sdt.h>
+        #endif
+        #define JKJ_DRAGONBOX_USDT_PROBE(name, arg) DTRACE_PROBE1(dragonbox, name, arg)
+    #else
+        #define JKJ_DRAGONBOX_USDT_PROBE(name, arg)
+    #endif
+
+    #if JKJ_DRAGONBOX_ENABLE_STATS || JKJ_DRAGONBOX_ENABLE_USDT_PROBES
+        #define JKJ_DRAGONBOX_RECORD_EVENT(counter, probe, arg)                                        \
+            JKJ_IF_NOT_CONSTEVAL {                                                                     \
+                JKJ_DRAGONBOX_STATS_ADD(counter, 1);                                                   \
+                JKJ_DRAGONBOX_USDT_PROBE(probe, arg);                                                  \
+            }
+        #define JKJ_DRAGONBOX_RECORD_TRAILING_ZEROS(count)                                             \
+            JKJ_IF_NOT_CONSTEVAL {                                                                     \
+                JKJ_DRAGONBOX_STATS_ADD(trailing_zero_removals, 1);                                    \
+                JKJ_DRAGONBOX_STATS_ADD(trailing_zeros_removed, count);                                \
+                JKJ_DRAGONBOX_USDT_PROBE(remove_trailing_zeros, count);                                \
+            }
+    #else
+        #define JKJ_DRAGONBOX_RECORD_EVENT(counter, probe, arg)
+        #define JKJ_DRAGONBOX_RECORD_TRAILING_ZEROS(count)
+    #endif
 #endif
 
 #ifndef JKJ_HEADER_DRAGONBOX
     #define JKJ_HEADER_DRAGONBOX
 
+    #if JKJ_DRAGONBOX_SHARED_TABLES
+// Type of the tables declared by JKJ_DRAGONBOX_SHARED_TABLES. It does not live inside JKJ_NAMESPACE,
+// since the tables are shared by all copies of this header in a program, whatever namespaces they
+// are compiled into.
+namespace jkj_dragonbox_shared_tables {
+    template <class T, decltype(sizeof(0)) N>
+    struct table {
+        T data_[N];
+    };
+}
+    #endif
+
 namespace JKJ_NAMESPACE {
     namespace dragonbox {
         ////////////////////////////////////////////////////////////////////////////////////////
@@ -1462,6 +1595,47 @@ namespace JKJ_NAMESPACE {
                         return n / divisor;
                     }
                 }
+
+                // Magic numbers for computing floor(n / divisor) as
+                // (n * magic_number) >> shift_amount for all 0 <= n <= n_max. With
+                // m = ceil(2^s / divisor), this is exact if (m * divisor - 2^s) * n_max < 2^s, and
+                // we take the smallest such s.
+                constexpr stdr::uint_fast64_t
+                compute_small_division_magic_number(stdr::uint_fast64_t divisor,
+                                                    int shift_amount) noexcept {
+                    return ((stdr::uint_fast64_t(1) << shift_amount) + divisor - 1) / divisor;
+                }
+
+                constexpr int compute_small_division_shift_amount(stdr::uint_fast64_t divisor,
+                                                                  stdr::uint_fast64_t n_max,
+                                                                  int shift_amount = 0) noexcept {
+                    return (compute_small_division_magic_number(divisor, shift_amount) * divisor -
+                            (stdr::uint_fast64_t(1) << shift_amount)) *
+                                       n_max <
+                                   (stdr::uint_fast64_t(1) << shift_amount)
+                               ? shift_amount
+                               : compute_small_division_shift_amount(divisor, n_max,
+                                                                     shift_amount + 1);
+                }
+
+                template <stdr::uint_fast32_t divisor, stdr::uint_fast32_t n_max>
+                struct small_division_info {
+                    static constexpr int shift_amount =
+                        compute_small_division_shift_amount(divisor, n_max);
+                    static constexpr auto magic_number = stdr::uint_fast32_t(
+                        compute_small_division_magic_number(divisor, shift_amount));
+                    static_assert(stdr::uint_fast64_t(magic_number) * n_max <=
+                                      UINT64_C(0xffffffff),
+                                  "");
+                };
+
+                // Compute floor(n / divisor) for small n and divisor.
+                // Precondition: n <= n_max
+                template <stdr::uint_fast32_t divisor, stdr::uint_fast32_t n_max>
+                constexpr stdr::uint_fast32_t small_division(stdr::uint_fast32_t n) noexcept {
+                    using info = small_division_info<divisor, n_max>;
+                    return stdr::uint_fast32_t((n * info::magic_number) >> info::shift_amount);
+                }
             }
         }
 
@@ -1541,6 +1715,25 @@ namespace JKJ_NAMESPACE {
         // Computed cache entries.
         ////////////////////////////////////////////////////////////////////////////////////////
 
+        namespace detail {
+            // Runtime reads of the tables of a cache holder. This is specialized for the holders
+            // whose tables are replaced by JKJ_DRAGONBOX_SHARED_TABLES.
+            template <class CacheHolder>
+            struct static_table_reader {
+                template <class Index>
+                static JKJ_CONSTEXPR20 typename CacheHolder::cache_entry_type
+                cache(Index idx) noexcept {
+                    return read_static_data(CacheHolder::cache.data() + idx);
+                }
+
+                template <class Index, class Holder = CacheHolder>
+                static JKJ_CONSTEXPR20 auto pow5_table(Index idx) noexcept
+                    -> decltype(Holder::pow5_table[0]) {
+                    return read_static_data(Holder::pow5_table.data() + idx);
+                }
+            };
+        }
+
         template <class FloatFormat, class Dummy = void>
         struct cache_holder;
 
@@ -2237,30 +2430,75 @@ namespace JKJ_NAMESPACE {
     #endif
 
         // Compressed cache.
-        template <class FloatFormat, class Dummy = void>
+        // Only every compression_ratio-th entry of the full cache is stored, and the entries in
+        // between are recovered by multiplying a power of 5. A larger ratio means a smaller table
+        // but more frequent recovery. The allowed ratios are those checked by
+        // verify_compressed_cache.
+        template <class FloatFormat>
+        struct compressed_cache_traits {
+            static constexpr int default_compression_ratio = 1;
+            static constexpr int max_compression_ratio = 1;
+            static constexpr bool is_valid_compression_ratio(int ratio) noexcept {
+                return ratio == 1;
+            }
+        };
+
+        template <>
+        struct compressed_cache_traits<ieee754_binary32> {
+            static constexpr int default_compression_ratio = 13;
+            // Powers of 5 up to 5^12 are computed from a table of 16-bit integers.
+            static constexpr int max_compression_ratio = 13;
+            static constexpr bool is_valid_compression_ratio(int ratio) noexcept {
+                return ratio >= 1 && ratio <= max_compression_ratio;
+            }
+        };
+
+        template <>
+        struct compressed_cache_traits<ieee754_binary64> {
+            static constexpr int default_compression_ratio = 27;
+            // The recovered cache is too large for the integer checks with the ratios 2 and 28.
+            static constexpr int max_compression_ratio = 27;
+            static constexpr bool is_valid_compression_ratio(int ratio) noexcept {
+                return ratio >= 1 && ratio <= max_compression_ratio && ratio != 2;
+            }
+        };
+
+        template <class FloatFormat,
+                  int compression_ratio_ =
+                      compressed_cache_traits<FloatFormat>::default_compression_ratio,
+                  class Dummy = void>
         struct compressed_cache_holder {
             using cache_entry_type = typename cache_holder<FloatFormat>::cache_entry_type;
             static constexpr int cache_bits = cache_holder<FloatFormat>::cache_bits;
             static constexpr int min_k = cache_holder<FloatFormat>::min_k;
             static constexpr int max_k = cache_holder<FloatFormat>::max_k;
+            static constexpr int compression_ratio = compression_ratio_;
+            static_assert(
+                compressed_cache_traits<FloatFormat>::is_valid_compression_ratio(compression_ratio),
+                "");
 
             template <class ShiftAmountType, class DecimalExponentType>
             static JKJ_CONSTEXPR20 cache_entry_type get_cache(DecimalExponentType k) noexcept {
-                return detail::read_static_data(cache_holder<FloatFormat>::cache.data() + k - min_k);
+                return detail::static_table_reader<cache_holder<FloatFormat>>::cache(k - min_k);
             }
         };
 
-        template <class Dummy>
-        struct compressed_cache_holder<ieee754_binary32, Dummy> {
+        template <int compression_ratio_, class Dummy>
+        struct compressed_cache_holder<ieee754_binary32, compression_ratio_, Dummy> {
             using cache_entry_type = cache_holder<ieee754_binary32>::cache_entry_type;
             static constexpr int cache_bits = cache_holder<ieee754_binary32>::cache_bits;
             static constexpr int min_k = cache_holder<ieee754_binary32>::min_k;
             static constexpr int max_k = cache_holder<ieee754_binary32>::max_k;
-            static constexpr int compression_ratio = 13;
+            static constexpr int compression_ratio = compression_ratio_;
+            static_assert(compressed_cache_traits<ieee754_binary32>::is_valid_compression_ratio(
+                              compression_ratio),
+                          "");
             static constexpr detail::stdr::size_t compressed_table_size =
                 detail::stdr::size_t((max_k - min_k + compression_ratio) / compression_ratio);
+            // Powers of 5 larger than 5^6 do not fit into 16 bits, so they are computed as
+            // 5^6 * 5^(offset - 6).
             static constexpr detail::stdr::size_t pow5_table_size =
-                detail::stdr::size_t((compression_ratio + 1) / 2);
+                detail::stdr::size_t(compression_ratio < 7 ? compression_ratio : 7);
 
             using cache_holder_t = detail::array<cache_entry_type, compressed_table_size>;
             using pow5_holder_t = detail::array<detail::stdr::uint_least16_t, pow5_table_size>;
@@ -2301,22 +2539,20 @@ namespace JKJ_NAMESPACE {
             template <class ShiftAmountType, class DecimalExponentType>
             static JKJ_CONSTEXPR20 cache_entry_type get_cache(DecimalExponentType k) noexcept {
                 // Compute the base index.
-                // Supposed to compute (k - min_k) / compression_ratio.
                 // Parentheses around min/max are to prevent macro expansions (e.g. in Windows.h).
-                static_assert(max_k - min_k <= 89 && compression_ratio == 13, "");
                 static_assert(
                     max_k - min_k <= (detail::stdr::numeric_limits<DecimalExponentType>::max)(), "");
                 using unsigned_exponent_type =
                     typename detail::stdr::make_unsigned<DecimalExponentType>::type;
-                auto const cache_index =
-                    DecimalExponentType(detail::stdr::uint_fast16_t(unsigned_exponent_type(k - min_k) *
-                                                                    detail::stdr::uint_fast16_t(79)) >>
-                                        10);
+                auto const cache_index = DecimalExponentType(
+                    detail::div::small_division<compression_ratio, max_k - min_k>(
+                        detail::stdr::uint_fast32_t(unsigned_exponent_type(k - min_k))));
                 auto const kb = DecimalExponentType(cache_index * compression_ratio + min_k);
                 auto const offset = DecimalExponentType(k - kb);
 
                 // Get the base cache.
-                auto const base_cache = detail::read_static_data(cache.data() + cache_index);
+                auto const base_cache =
+                    detail::static_table_reader<compressed_cache_holder>::cache(cache_index);
 
                 if (offset == 0) {
                     return base_cache;
@@ -2328,13 +2564,16 @@ namespace JKJ_NAMESPACE {
                     assert(alpha > 0 && alpha < 32);
 
                     // Try to recover the real cache.
-                    constexpr auto pow5_6 = detail::stdr::uint_fast32_t(pow5_table[6]);
+                    constexpr auto pow5_6 =
+                        detail::compute_power<6>(detail::stdr::uint_fast32_t(5));
                     auto const pow5 =
-                        offset >= 7
+                        compression_ratio > 7 && offset >= 7
                             ? detail::stdr::uint_fast32_t(
-                                  pow5_6 * detail::read_static_data(pow5_table.data() + offset - 6))
+                                  pow5_6 * detail::static_table_reader<
+                                               compressed_cache_holder>::pow5_table(offset - 6))
                             : detail::stdr::uint_fast32_t(
-                                  detail::read_static_data(pow5_table.data() + offset));
+                                  detail::static_table_reader<compressed_cache_holder>::pow5_table(
+                                      offset));
                     auto mul_result = detail::wuint::umul96(pow5, base_cache);
 
                     auto const recovered_cache =
@@ -2357,21 +2596,26 @@ namespace JKJ_NAMESPACE {
             }
         };
     #if !JKJ_HAS_INLINE_VARIABLE
-        template <class Dummy>
-        constexpr typename compressed_cache_holder<ieee754_binary32, Dummy>::cache_holder_t
-            compressed_cache_holder<ieee754_binary32, Dummy>::cache;
-        template <class Dummy>
-        constexpr typename compressed_cache_holder<ieee754_binary32, Dummy>::pow5_holder_t
-            compressed_cache_holder<ieee754_binary32, Dummy>::pow5_table;
+        template <int compression_ratio_, class Dummy>
+        constexpr typename compressed_cache_holder<ieee754_binary32, compression_ratio_,
+                                                   Dummy>::cache_holder_t
+            compressed_cache_holder<ieee754_binary32, compression_ratio_, Dummy>::cache;
+        template <int compression_ratio_, class Dummy>
+        constexpr typename compressed_cache_holder<ieee754_binary32, compression_ratio_,
+                                                   Dummy>::pow5_holder_t
+            compressed_cache_holder<ieee754_binary32, compression_ratio_, Dummy>::pow5_table;
     #endif
 
-        template <class Dummy>
-        struct compressed_cache_holder<ieee754_binary64, Dummy> {
+        template <int compression_ratio_, class Dummy>
+        struct compressed_cache_holder<ieee754_binary64, compression_ratio_, Dummy> {
             using cache_entry_type = cache_holder<ieee754_binary64>::cache_entry_type;
             static constexpr int cache_bits = cache_holder<ieee754_binary64>::cache_bits;
             static constexpr int min_k = cache_holder<ieee754_binary64>::min_k;
             static constexpr int max_k = cache_holder<ieee754_binary64>::max_k;
-            static constexpr int compression_ratio = 27;
+            static constexpr int compression_ratio = compression_ratio_;
+            static_assert(compressed_cache_traits<ieee754_binary64>::is_valid_compression_ratio(
+                              compression_ratio),
+                          "");
             static constexpr detail::stdr::size_t compressed_table_size =
                 detail::stdr::size_t((max_k - min_k + compression_ratio) / compression_ratio);
             static constexpr detail::stdr::size_t pow5_table_size =
@@ -2416,22 +2660,20 @@ namespace JKJ_NAMESPACE {
             template <class ShiftAmountType, class DecimalExponentType>
             static JKJ_CONSTEXPR20 cache_entry_type get_cache(DecimalExponentType k) noexcept {
                 // Compute the base index.
-                // Supposed to compute (k - min_k) / compression_ratio.
                 // Parentheses around min/max are to prevent macro expansions (e.g. in Windows.h).
-                static_assert(max_k - min_k <= 619 && compression_ratio == 27, "");
                 static_assert(
                     max_k - min_k <= (detail::stdr::numeric_limits<DecimalExponentType>::max)(), "");
                 using unsigned_exponent_type =
                     typename detail::stdr::make_unsigned<DecimalExponentType>::type;
-                auto const cache_index =
-                    DecimalExponentType(detail::stdr::uint_fast32_t(unsigned_exponent_type(k - min_k) *
-                                                                    detail::stdr::uint_fast32_t(607)) >>
-                                        14);
+                auto const cache_index = DecimalExponentType(
+                    detail::div::small_division<compression_ratio, max_k - min_k>(
+                        detail::stdr::uint_fast32_t(unsigned_exponent_type(k - min_k))));
                 auto const kb = DecimalExponentType(cache_index * compression_ratio + min_k);
                 auto const offset = DecimalExponentType(k - kb);
 
                 // Get the base cache.
-                auto const base_cache = detail::read_static_data(cache.data() + cache_index);
+                auto const base_cache =
+                    detail::static_table_reader<compressed_cache_holder>::cache(cache_index);
 
                 if (offset == 0) {
                     return base_cache;
@@ -2443,7 +2685,8 @@ namespace JKJ_NAMESPACE {
                     assert(alpha > 0 && alpha < 64);
 
                     // Try to recover the real cache.
-                    auto const pow5 = detail::read_static_data(pow5_table.data() + offset);
+                    auto const pow5 =
+                        detail::static_table_reader<compressed_cache_holder>::pow5_table(offset);
                     auto recovered_cache = detail::wuint::umul128(base_cache.high(), pow5);
                     auto const middle_low = detail::wuint::umul128(base_cache.low(), pow5);
 
@@ -2468,14 +2711,378 @@ namespace JKJ_NAMESPACE {
             }
         };
     #if !JKJ_HAS_INLINE_VARIABLE
-        template <class Dummy>
-        constexpr typename compressed_cache_holder<ieee754_binary64, Dummy>::cache_holder_t
-            compressed_cache_holder<ieee754_binary64, Dummy>::cache;
-        template <class Dummy>
-        constexpr typename compressed_cache_holder<ieee754_binary64, Dummy>::pow5_holder_t
-            compressed_cache_holder<ieee754_binary64, Dummy>::pow5_table;
+        template <int compression_ratio_, class Dummy>
+        constexpr typename compressed_cache_holder<ieee754_binary64, compression_ratio_,
+                                                   Dummy>::cache_holder_t
+            compressed_cache_holder<ieee754_binary64, compression_ratio_, Dummy>::cache;
+        template <int compression_ratio_, class Dummy>
+        constexpr typename compressed_cache_holder<ieee754_binary64, compression_ratio_,
+                                                   Dummy>::pow5_holder_t
+            compressed_cache_holder<ieee754_binary64, compression_ratio_, Dummy>::pow5_table;
     #endif
 
+    #if JKJ_DRAGONBOX_SHARED_TABLES
+        namespace detail {
+            // See the description of JKJ_DRAGONBOX_SHARED_TABLES above.
+            namespace shared_tables {
+                template <class T, stdr::size_t N>
+                using table = ::jkj_dragonbox_shared_tables::table<T, N>;
+
+                // Two declarations of a variable with C language linkage in different namespaces
+                // refer to the same variable, so copies of this header compiled into namespaces
+                // other than the default one (e.g. for several instruction sets) read the same
+                // tables. Each entry of the binary64 caches is stored as its upper half followed
+                // by its lower half.
+                extern "C" {
+                extern JKJ_DRAGONBOX_TABLE_API table<
+                    stdr::uint_least64_t,
+                    stdr::size_t(cache_holder<ieee754_binary32>::max_k -
+                                 cache_holder<ieee754_binary32>::min_k + 1)> const
+                    jkj_dragonbox_binary32_cache;
+                extern JKJ_DRAGONBOX_TABLE_API table<
+                    stdr::uint_least64_t,
+                    stdr::size_t(cache_holder<ieee754_binary64>::max_k -
+                                 cache_holder<ieee754_binary64>::min_k + 1) *
+                        2> const jkj_dragonbox_binary64_cache;
+                extern JKJ_DRAGONBOX_TABLE_API
+                    table<stdr::uint_least64_t,
+                          compressed_cache_holder<ieee754_binary32>::compressed_table_size> const
+                        jkj_dragonbox_binary32_compressed_cache;
+                extern JKJ_DRAGONBOX_TABLE_API
+                    table<stdr::uint_least16_t,
+                          compressed_cache_holder<ieee754_binary32>::pow5_table_size> const
+                        jkj_dragonbox_binary32_pow5_table;
+                extern JKJ_DRAGONBOX_TABLE_API
+                    table<stdr::uint_least64_t,
+                          compressed_cache_holder<ieee754_binary64>::compressed_table_size * 2> const
+                        jkj_dragonbox_binary64_compressed_cache;
+                extern JKJ_DRAGONBOX_TABLE_API
+                    table<stdr::uint_least64_t,
+                          compressed_cache_holder<ieee754_binary64>::pow5_table_size> const
+                        jkj_dragonbox_binary64_pow5_table;
+                }
+            }
+
+            // The tables in this header are only read in constant evaluation.
+            template <>
+            struct static_table_reader<cache_holder<ieee754_binary32>> {
+                using holder = cache_holder<ieee754_binary32>;
+
+                template <class Index>
+                static JKJ_CONSTEXPR20 holder::cache_entry_type cache(Index idx) noexcept {
+                    JKJ_IF_CONSTEVAL { return holder::cache[stdr::size_t(idx)]; }
+                    else {
+                        return read_static_data(shared_tables::jkj_dragonbox_binary32_cache.data_ +
+                                                idx);
+                    }
+                }
+            };
+
+            template <>
+            struct static_table_reader<cache_holder<ieee754_binary64>> {
+                using holder = cache_holder<ieee754_binary64>;
+
+                template <class Index>
+                static JKJ_CONSTEXPR20 holder::cache_entry_type cache(Index idx) noexcept {
+                    JKJ_IF_CONSTEVAL { return holder::cache[stdr::size_t(idx)]; }
+                    else {
+                        auto const ptr =
+                            shared_tables::jkj_dragonbox_binary64_cache.data_ + stdr::size_t(idx) * 2;
+                        return {read_static_data(ptr), read_static_data(ptr + 1)};
+                    }
+                }
+            };
+
+            template <>
+            struct static_table_reader<compressed_cache_holder<ieee754_binary32>> {
+                using holder = compressed_cache_holder<ieee754_binary32>;
+
+                template <class Index>
+                static JKJ_CONSTEXPR20 holder::cache_entry_type cache(Index idx) noexcept {
+                    JKJ_IF_CONSTEVAL { return holder::cache[stdr::size_t(idx)]; }
+                    else {
+                        return read_static_data(
+                            shared_tables::jkj_dragonbox_binary32_compressed_cache.data_ + idx);
+                    }
+                }
+
+                template <class Index>
+                static JKJ_CONSTEXPR20 stdr::uint_least16_t pow5_table(Index idx) noexcept {
+                    JKJ_IF_CONSTEVAL { return holder::pow5_table[stdr::size_t(idx)]; }
+                    else {
+                        return read_static_data(
+                            shared_tables::jkj_dragonbox_binary32_pow5_table.data_ + idx);
+                    }
+                }
+            };
+
+            template <>
+            struct static_table_reader<compressed_cache_holder<ieee754_binary64>> {
+                using holder = compressed_cache_holder<ieee754_binary64>;
+
+                template <class Index>
+                static JKJ_CONSTEXPR20 holder::cache_entry_type cache(Index idx) noexcept {
+                    JKJ_IF_CONSTEVAL { return holder::cache[stdr::size_t(idx)]; }
+                    else {
+                        auto const ptr = shared_tables::jkj_dragonbox_binary64_compressed_cache.data_ +
+                                         stdr::size_t(idx) * 2;
+                        return {read_static_data(ptr), read_static_data(ptr + 1)};
+                    }
+                }
+
+                template <class Index>
+                static JKJ_CONSTEXPR20 stdr::uint_least64_t pow5_table(Index idx) noexcept {
+                    JKJ_IF_CONSTEVAL { return holder::pow5_table[stdr::size_t(idx)]; }
+                    else {
+                        return read_static_data(
+                            shared_tables::jkj_dragonbox_binary64_pow5_table.data_ + idx);
+                    }
+                }
+            };
+        }
+    #endif
+
+        namespace detail {
+            // Full cache expanded from the compressed cache on first use. Only the compressed
+            // cache is stored in the binary; the expanded table is zero-initialized (so it does
+            // not occupy any space in the binary, and its pages are not touched unless used) and
+            // gets filled all at once, thread-safely, when get_cache is called for the first time.
+            // The entries are the ones recovered by compressed_cache_holder, which may differ from
+            // the ones in cache_holder.
+            template <class FloatFormat, class Dummy = void>
+            struct lazy_cache_holder {
+                using compressed_holder = compressed_cache_holder<FloatFormat>;
+                using cache_entry_type = typename compressed_holder::cache_entry_type;
+                static constexpr int cache_bits = compressed_holder::cache_bits;
+                static constexpr int min_k = compressed_holder::min_k;
+                static constexpr int max_k = compressed_holder::max_k;
+
+                using cache_holder_t = array<cache_entry_type, stdr::size_t(max_k - min_k + 1)>;
+
+                static cache_holder_t make_cache() noexcept {
+                    cache_holder_t res{};
+                    for (int k = min_k; k <= max_k; ++k) {
+                        res[stdr::size_t(k - min_k)] =
+                            compressed_holder::template get_cache<int>(k);
+                    }
+                    return res;
+                }
+
+                // The initialization of the function-local static is what makes the expansion
+                // thread-safe, at the cost of checking its guard variable on every lookup, which
+                // makes lookups slightly slower than with cache_holder.
+                static cache_holder_t const& get_expanded_cache() noexcept {
+                    static cache_holder_t const cache = make_cache();
+                    return cache;
+                }
+
+                template <class ShiftAmountType, class DecimalExponentType>
+                static JKJ_CONSTEXPR20 cache_entry_type get_cache(DecimalExponentType k) noexcept {
+                    JKJ_IF_CONSTEVAL {
+                        return compressed_holder::template get_cache<ShiftAmountType>(k);
+                    }
+                    return get_expanded_cache()[stdr::size_t(k - min_k)];
+                }
+            };
+
+            // Slice of the full cache needed for inputs x with
+            // 10^min_decimal_exponent <= |x| <= 10^max_decimal_exponent. Other inputs fall back to
+            // the compressed cache.
+            template <class FloatFormat, int min_decimal_exponent, int max_decimal_exponent,
+                      class Dummy = void>
+            struct cache_slice_holder {
+                using full_holder = cache_holder<FloatFormat>;
+                using fallback_holder = compressed_cache_holder<FloatFormat>;
+                using cache_entry_type = typename full_holder::cache_entry_type;
+                static constexpr int cache_bits = full_holder::cache_bits;
+
+                static_assert(min_decimal_exponent <= max_decimal_exponent &&
+                                  min_decimal_exponent >= -1233 && max_decimal_exponent <= 1233,
+                              "");
+
+                // Trailing underscores are to avoid name clash with macros (e.g. Windows.h).
+                static constexpr int min_(int x, int y) noexcept { return x < y ? x : y; }
+                static constexpr int max_(int x, int y) noexcept { return x > y ? x : y; }
+
+                static constexpr int significand_bits = FloatFormat::significand_bits;
+                static constexpr int kappa =
+                    log::floor_log10_pow2(FloatFormat::total_bits - significand_bits - 2) - 1;
+
+                // The binary exponent e of x = f * 2^e, where 2^significand_bits <= f <
+                // 2^(significand_bits + 1) for normal numbers, satisfies
+                // 2^(e + significand_bits) <= |x| < 2^(e + significand_bits + 1).
+                static constexpr int min_binary_exponent =
+                    min_(max_(log::floor_log2_pow10(min_decimal_exponent) - significand_bits,
+                              FloatFormat::min_exponent - significand_bits),
+                         FloatFormat::max_exponent - significand_bits);
+                static constexpr int max_binary_exponent =
+                    min_(max_(log::floor_log2_pow10(max_decimal_exponent) - significand_bits,
+                              FloatFormat::min_exponent - significand_bits),
+                         FloatFormat::max_exponent - significand_bits);
+
+                // Same as the computation of k in the main algorithm, both for the normal and the
+                // shorter interval cases.
+                static constexpr int min_k = max_(
+                    min_(kappa - log::floor_log10_pow2(max_binary_exponent),
+                         -log::floor_log10_pow2_minus_log10_4_over_3(max_binary_exponent)),
+                    full_holder::min_k);
+                static constexpr int max_k = min_(
+                    max_(kappa - log::floor_log10_pow2(min_binary_exponent),
+                         -log::floor_log10_pow2_minus_log10_4_over_3(min_binary_exponent)),
+                    full_holder::max_k);
+                static_assert(min_k <= max_k, "");
+
+                static constexpr stdr::size_t cache_size = stdr::size_t(max_k - min_k + 1);
+                using cache_holder_t = array<cache_entry_type, cache_size>;
+
+    #if JKJ_HAS_CONSTEXPR17
+                static constexpr cache_holder_t cache JKJ_STATIC_DATA_SECTION = [] {
+                    cache_holder_t res{};
+                    for (stdr::size_t i = 0; i < cache_size; ++i) {
+                        res[i] = full_holder::cache[i + stdr::size_t(min_k - full_holder::min_k)];
+                    }
+                    return res;
+                }();
+    #else
+                template <stdr::size_t... indices>
+                static constexpr cache_holder_t make_cache(index_sequence<indices...>) {
+                    return {full_holder::cache[indices + stdr::size_t(min_k - full_holder::min_k)]...};
+                }
+                static constexpr cache_holder_t cache JKJ_STATIC_DATA_SECTION =
+                    make_cache(make_index_sequence<cache_size>{});
+    #endif
+
+                template <class ShiftAmountType, class DecimalExponentType>
+                static JKJ_CONSTEXPR20 cache_entry_type get_cache(DecimalExponentType k) noexcept {
+                    if (k >= min_k && k <= max_k) {
+                        return read_static_data(cache.data() + stdr::size_t(k - min_k));
+                    }
+                    return fallback_holder::template get_cache<ShiftAmountType>(k);
+                }
+            };
+    #if !JKJ_HAS_INLINE_VARIABLE
+            template <class FloatFormat, int min_decimal_exponent, int max_decimal_exponent,
+                      class Dummy>
+            constexpr typename cache_slice_holder<FloatFormat, min_decimal_exponent,
+                                                  max_decimal_exponent, Dummy>::cache_holder_t
+                cache_slice_holder<FloatFormat, min_decimal_exponent, max_decimal_exponent,
+                                   Dummy>::cache;
+    #endif
+
+            // Full cache entries together with k and beta for the normal interval case, indexed by
+            // the exponent bits. The entry for the exponent bits of infinities and NaNs is unused.
+            template <class FloatFormat, class Dummy = void>
+            struct exponent_indexed_cache_holder {
+                using full_holder = cache_holder<FloatFormat>;
+                using cache_entry_type = typename full_holder::cache_entry_type;
+
+                struct entry_type {
+                    cache_entry_type cache;
+                    stdr::int_least16_t minus_k;
+                    stdr::int_least16_t beta;
+                };
+
+                static constexpr int significand_bits = FloatFormat::significand_bits;
+                static constexpr int kappa =
+                    log::floor_log10_pow2(FloatFormat::total_bits - significand_bits - 2) - 1;
+                static constexpr stdr::size_t table_size = stdr::size_t(1)
+                                                           << FloatFormat::exponent_bits;
+                using table_t = array<entry_type, table_size>;
+
+                static JKJ_CONSTEXPR14 entry_type make_entry(stdr::size_t exponent_bits) noexcept {
+                    // Same as the computation of k and beta in the main algorithm.
+                    auto const binary_exponent =
+                        exponent_bits == 0
+                            ? FloatFormat::min_exponent - significand_bits
+                            : (exponent_bits == table_size - 1 ? FloatFormat::max_exponent
+                                                                 : int(exponent_bits) +
+                                                                       FloatFormat::exponent_bias) -
+                                  significand_bits;
+                    auto const minus_k = log::floor_log10_pow2(binary_exponent) - kappa;
+                    auto const beta = binary_exponent + log::floor_log2_pow10(-minus_k);
+                    return {full_holder::cache[stdr::size_t(-minus_k - full_holder::min_k)],
+                            stdr::int_least16_t(minus_k), stdr::int_least16_t(beta)};
+                }
+
+    #if JKJ_HAS_CONSTEXPR17
+                static constexpr table_t table JKJ_STATIC_DATA_SECTION = [] {
+                    table_t res{};
+                    for (stdr::size_t i = 0; i < table_size; ++i) {
+                        res[i] = make_entry(i);
+                    }
+                    return res;
+                }();
+
+                static JKJ_CONSTEXPR20 entry_type get_entry(stdr::size_t exponent_bits) noexcept {
+                    return read_static_data(table.data() + exponent_bits);
+                }
+    #else
+                // The table is too large to be generated with index_sequence, so it is filled
+                // when it is used for the first time.
+                static table_t make_table() noexcept {
+                    table_t res{};
+                    for (stdr::size_t i = 0; i < table_size; ++i) {
+                        res[i] = make_entry(i);
+                    }
+                    return res;
+                }
+
+                static entry_type get_entry(stdr::size_t exponent_bits) noexcept {
+                    static table_t const table = make_table();
+                    return table[exponent_bits];
+                }
+    #endif
+            };
+    #if JKJ_HAS_CONSTEXPR17 && !JKJ_HAS_INLINE_VARIABLE
+            template <class FloatFormat, class Dummy>
+            constexpr typename exponent_indexed_cache_holder<FloatFormat, Dummy>::table_t
+                exponent_indexed_cache_holder<FloatFormat, Dummy>::table;
+    #endif
+
+            // The result of the shorter interval case before the trailing zero policy is applied.
+            template <class CarrierUInt>
+            struct shorter_interval_entry {
+                CarrierUInt significand;
+                stdr::int_least16_t exponent;
+                // Whether the bigger divisor succeeded, so the significand may have trailing zeros.
+                bool may_have_trailing_zeros;
+            };
+
+            // Results of the shorter interval case indexed by the exponent bits. Defined after the
+            // main algorithm, from which they are generated.
+            template <class FormatTraits, class BinaryToDecimalRoundingPolicy>
+            struct shorter_interval_table;
+
+            // Cache for FloatFormat when binary32 shares the binary64 table of Binary64CachePolicy.
+            template <class FloatFormat, class Binary64CachePolicy>
+            struct shared_cache_holder
+                : Binary64CachePolicy::template cache_holder_type<FloatFormat> {
+                template <class ShiftAmountType, class DecimalExponentType>
+                static JKJ_CONSTEXPR20 typename cache_holder<FloatFormat>::cache_entry_type
+                get_cache(DecimalExponentType k) noexcept {
+                    return Binary64CachePolicy::template get_cache<FloatFormat, ShiftAmountType>(k);
+                }
+            };
+
+            // The binary32 entry for k is the binary64 entry for the same k, rounded up to its upper
+            // 64 bits, since both are normalized to have the most significant bit set.
+            template <class Binary64CachePolicy>
+            struct shared_cache_holder<ieee754_binary32, Binary64CachePolicy> {
+                using cache_entry_type = cache_holder<ieee754_binary32>::cache_entry_type;
+                static constexpr int cache_bits = cache_holder<ieee754_binary32>::cache_bits;
+                static constexpr int min_k = cache_holder<ieee754_binary32>::min_k;
+                static constexpr int max_k = cache_holder<ieee754_binary32>::max_k;
+
+                template <class ShiftAmountType, class DecimalExponentType>
+                static JKJ_CONSTEXPR20 cache_entry_type get_cache(DecimalExponentType k) noexcept {
+                    auto const entry =
+                        Binary64CachePolicy::template get_cache<ieee754_binary64, ShiftAmountType>(
+                            k);
+                    return cache_entry_type(entry.high() + (entry.low() != 0 ? 1 : 0));
+                }
+            };
+        }
+
         ////////////////////////////////////////////////////////////////////////////////////////
         // Forward declarations of user-specializable templates used in the main algorithm.
         ////////////////////////////////////////////////////////////////////////////////////////
@@ -3052,8 +3659,7 @@ namespace JKJ_NAMESPACE {
                         assert(k >= cache_holder_type<FloatFormat>::min_k &&
                                k <= cache_holder_type<FloatFormat>::max_k);
 
-                        return detail::read_static_data(
-                            cache_holder_type<FloatFormat>::cache.data() +
+                        return detail::static_table_reader<cache_holder_type<FloatFormat>>::cache(
                             detail::stdr::size_t(k - cache_holder_type<FloatFormat>::min_k));
                     }
                 } full = {};
@@ -3072,6 +3678,139 @@ namespace JKJ_NAMESPACE {
                         return cache_holder_type<FloatFormat>::template get_cache<ShiftAmountType>(k);
                     }
                 } compact = {};
+
+                // Same as compact, but with the given compression ratio instead of the default one
+                // (13 for binary32 and 27 for binary64). A smaller ratio gives a larger table but
+                // recovers fewer entries. See compressed_cache_traits for the allowed ratios.
+                template <int CompressionRatio>
+                struct compact_with_ratio_t {
+                    using cache_policy = compact_with_ratio_t;
+                    template <class FloatFormat>
+                    using cache_holder_type = compressed_cache_holder<FloatFormat, CompressionRatio>;
+
+                    template <class FloatFormat, class ShiftAmountType, class DecimalExponentType>
+                    static JKJ_CONSTEXPR20 typename cache_holder<FloatFormat>::cache_entry_type
+                    get_cache(DecimalExponentType k) noexcept {
+                        assert(k >= cache_holder<FloatFormat>::min_k &&
+                               k <= cache_holder<FloatFormat>::max_k);
+
+                        return cache_holder_type<FloatFormat>::template get_cache<ShiftAmountType>(k);
+                    }
+                };
+
+                // Stores only the compressed cache like compact, but expands it into the full cache
+                // when it is used for the first time, so that afterwards it runs at the speed of
+                // full. Intended for programs that rarely format.
+                JKJ_INLINE_VARIABLE struct lazy_full_t {
+                    using cache_policy = lazy_full_t;
+                    // The recovered cache entries are those of the compressed cache.
+                    template <class FloatFormat>
+                    using cache_holder_type = compressed_cache_holder<FloatFormat>;
+
+                    template <class FloatFormat, class ShiftAmountType, class DecimalExponentType>
+                    static JKJ_CONSTEXPR20 typename cache_holder<FloatFormat>::cache_entry_type
+                    get_cache(DecimalExponentType k) noexcept {
+                        assert(k >= cache_holder<FloatFormat>::min_k &&
+                               k <= cache_holder<FloatFormat>::max_k);
+
+                        return detail::lazy_cache_holder<FloatFormat>::template get_cache<
+                            ShiftAmountType>(k);
+                    }
+                } lazy_full = {};
+
+                // Stores only the part of the full cache needed for inputs x with
+                // 10^MinDecimalExponent <= |x| <= 10^MaxDecimalExponent, for callers knowing the
+                // range of their inputs. Other inputs are still handled correctly, but at the speed
+                // of compact.
+                template <int MinDecimalExponent, int MaxDecimalExponent>
+                struct range_t {
+                    using cache_policy = range_t;
+                    // Out-of-range cache entries are those of the compressed cache.
+                    template <class FloatFormat>
+                    using cache_holder_type = compressed_cache_holder<FloatFormat>;
+
+                    template <class FloatFormat, class ShiftAmountType, class DecimalExponentType>
+                    static JKJ_CONSTEXPR20 typename cache_holder<FloatFormat>::cache_entry_type
+                    get_cache(DecimalExponentType k) noexcept {
+                        assert(k >= cache_holder<FloatFormat>::min_k &&
+                               k <= cache_holder<FloatFormat>::max_k);
+
+                        return detail::cache_slice_holder<
+                            FloatFormat, MinDecimalExponent,
+                            MaxDecimalExponent>::template get_cache<ShiftAmountType>(k);
+                    }
+                };
+
+                // Uses the full cache together with k and beta precomputed for each value of the
+                // exponent bits, trading a larger table (48 KB for binary64 and 4 KB for binary32)
+                // for skipping their computation in the normal interval case.
+                JKJ_INLINE_VARIABLE struct exponent_indexed_t {
+                    using cache_policy = exponent_indexed_t;
+                    template <class FloatFormat>
+                    using cache_holder_type = cache_holder<FloatFormat>;
+
+                    template <class FloatFormat, class ShiftAmountType, class DecimalExponentType>
+                    static JKJ_CONSTEXPR20 typename cache_holder_type<FloatFormat>::cache_entry_type
+                    get_cache(DecimalExponentType k) noexcept {
+                        return full_t::template get_cache<FloatFormat, ShiftAmountType>(k);
+                    }
+
+                    template <class FloatFormat, class ExponentInt>
+                    static JKJ_CONSTEXPR20
+                        typename detail::exponent_indexed_cache_holder<FloatFormat>::entry_type
+                        get_exponent_indexed_entry(ExponentInt exponent_bits) noexcept {
+                        return detail::exponent_indexed_cache_holder<FloatFormat>::get_entry(
+                            detail::stdr::size_t(exponent_bits));
+                    }
+                } exponent_indexed = {};
+
+                // Same as Binary64CachePolicy (either full_t or compact_t) for binary64, but derives
+                // the binary32 cache from the binary64 one instead of using a separate table, so
+                // that programs formatting both float and double keep only one table in the cache.
+                template <class Binary64CachePolicy>
+                struct shared_t {
+                    static_assert(detail::stdr::is_same<Binary64CachePolicy, full_t>::value ||
+                                      detail::stdr::is_same<Binary64CachePolicy, compact_t>::value,
+                                  "");
+
+                    using cache_policy = shared_t;
+                    template <class FloatFormat>
+                    using cache_holder_type =
+                        detail::shared_cache_holder<FloatFormat, Binary64CachePolicy>;
+
+                    template <class FloatFormat, class ShiftAmountType, class DecimalExponentType>
+                    static JKJ_CONSTEXPR20 typename cache_holder<FloatFormat>::cache_entry_type
+                    get_cache(DecimalExponentType k) noexcept {
+                        assert(k >= cache_holder<FloatFormat>::min_k &&
+                               k <= cache_holder<FloatFormat>::max_k);
+
+                        return cache_holder_type<FloatFormat>::template get_cache<ShiftAmountType>(k);
+                    }
+                };
+                JKJ_INLINE_VARIABLE shared_t<full_t> shared_full = {};
+                JKJ_INLINE_VARIABLE shared_t<compact_t> shared_compact = {};
+
+                // Same as CachePolicy, but looks up the results of the shorter interval case (inputs
+                // with all significand bits zero, e.g. powers of two) in a table indexed by the
+                // exponent bits and generated at compile time, instead of computing them. Each table
+                // is 32 KB for binary64 and 2 KB for binary32, and one is generated for each
+                // combination of the interval type and the binary-to-decimal rounding policy used.
+                template <class CachePolicy = full_t>
+                struct with_shorter_interval_table_t : CachePolicy {
+                    using cache_policy = with_shorter_interval_table_t;
+
+                    template <class FormatTraits, class BinaryToDecimalRoundingPolicy,
+                              class IntervalType, class ExponentInt>
+                    static JKJ_CONSTEXPR20
+                        detail::shorter_interval_entry<typename FormatTraits::carrier_uint>
+                        get_shorter_interval_entry(IntervalType interval_type,
+                                                   ExponentInt exponent_bits) noexcept {
+                        return detail::shorter_interval_table<FormatTraits,
+                                                              BinaryToDecimalRoundingPolicy>::
+                            get_entry(interval_type, detail::stdr::size_t(exponent_bits));
+                    }
+                };
+                JKJ_INLINE_VARIABLE with_shorter_interval_table_t<> with_shorter_interval_table = {};
             }
 
             namespace preferred_integer_types {
@@ -3160,6 +3899,38 @@ namespace JKJ_NAMESPACE {
                     using shift_amount_type = detail::stdr::int_least8_t;
                 } minimal;
             }
+
+            namespace branching {
+                // Only affects the round-to-nearest computation; the directed rounding modes have
+                // few enough data-dependent branches already.
+                enum class tag_t { branchy, branchless };
+
+                JKJ_INLINE_VARIABLE struct branchy_t {
+                    using branching_policy = branchy_t;
+                    static constexpr auto tag = tag_t::branchy;
+                } branchy = {};
+
+                // Compute the results for both the larger and the smaller divisor, and select
+                // among them with conditional moves instead of branching on the remainder.
+                JKJ_INLINE_VARIABLE struct branchless_t {
+                    using branching_policy = branchless_t;
+                    static constexpr auto tag = tag_t::branchless;
+                } branchless = {};
+            }
+
+            namespace integer_fast_path {
+                JKJ_INLINE_VARIABLE struct disabled_t {
+                    using integer_fast_path_policy = disabled_t;
+                    static constexpr bool detect_integers = false;
+                } disabled = {};
+
+                // Integers below 2^(significand_bits + 1) are detected from the bits and returned
+                // without going through the main algorithm.
+                JKJ_INLINE_VARIABLE struct enabled_t {
+                    using integer_fast_path_policy = enabled_t;
+                    static constexpr bool detect_integers = true;
+                } enabled = {};
+            }
         }
 
         ////////////////////////////////////////////////////////////////////////////////////////
@@ -3394,6 +4165,47 @@ namespace JKJ_NAMESPACE {
             }
         };
 
+    #if JKJ_DRAGONBOX_ENABLE_STATS
+        ////////////////////////////////////////////////////////////////////////////////////////
+        // Per-thread counters of the branches taken by the main algorithm.
+        ////////////////////////////////////////////////////////////////////////////////////////
+
+        namespace stats {
+            // Every call to the main algorithm ends in exactly one of shorter_interval_cases,
+            // big_divisor_exits and small_divisor_cases, so their sum equals the sum of the three
+            // *_calls counters. Only the nearest rounding mode has a dedicated shorter interval path.
+            struct counters {
+                detail::stdr::uint_least64_t nearest_calls;
+                detail::stdr::uint_least64_t left_closed_directed_calls;
+                detail::stdr::uint_least64_t right_closed_directed_calls;
+                detail::stdr::uint_least64_t shorter_interval_cases;
+                // Returned early from Step 2 with the bigger divisor.
+                detail::stdr::uint_least64_t big_divisor_exits;
+                // Fell through to Step 3 with the smaller divisor.
+                detail::stdr::uint_least64_t small_divisor_cases;
+                // Number of times the trailing zero policy is asked to handle possible trailing
+                // zeros, and the total number of trailing zeros it removed.
+                detail::stdr::uint_least64_t trailing_zero_removals;
+                detail::stdr::uint_least64_t trailing_zeros_removed;
+            };
+        }
+
+        namespace detail {
+            inline stats::counters& thread_local_stats() noexcept {
+                static thread_local stats::counters instance{};
+                return instance;
+            }
+        }
+
+        namespace stats {
+            // Returns the counters of the calling thread.
+            inline counters get() noexcept { return detail::thread_local_stats(); }
+
+            // Clears the counters of the calling thread.
+            inline void reset() noexcept { detail::thread_local_stats() = counters{}; }
+        }
+    #endif
+
         namespace detail {
             ////////////////////////////////////////////////////////////////////////////////////////
             // The main algorithm.
@@ -3468,11 +4280,206 @@ namespace JKJ_NAMESPACE {
                     decimal_fp<carrier_uint, decimal_exponent_type<PreferredIntegerTypesPolicy>,
                                SignPolicy::return_has_sign, TrailingZeroPolicy::report_trailing_zeros>;
 
-                //// The main algorithm assumes the input is a normal/subnormal finite number.
+                // k, the cache, and beta for the normal interval case.
+                template <class CacheEntryType, class DecimalExponentType, class ShiftAmountType>
+                struct normal_interval_multiplier {
+                    DecimalExponentType minus_k;
+                    CacheEntryType cache;
+                    ShiftAmountType beta;
+                };
+
+                // Cache policies with get_exponent_indexed_entry provide them precomputed for each
+                // value of the exponent bits.
+                template <class CachePolicy, class CacheEntryType, class DecimalExponentType,
+                          class ShiftAmountType,
+                          class = decltype(CachePolicy::template get_exponent_indexed_entry<format>(
+                              exponent_int()))>
+                static JKJ_CONSTEXPR20
+                    normal_interval_multiplier<CacheEntryType, DecimalExponentType, ShiftAmountType>
+                    compute_normal_interval_multiplier(exponent_int exponent_bits, exponent_int,
+                                                       int) noexcept {
+                    auto const entry =
+                        CachePolicy::template get_exponent_indexed_entry<format>(exponent_bits);
+                    return {DecimalExponentType(entry.minus_k), entry.cache,
+                            ShiftAmountType(entry.beta)};
+                }
+
+                template <class CachePolicy, class CacheEntryType, class DecimalExponentType,
+                          class ShiftAmountType>
+                static JKJ_CONSTEXPR20
+                    normal_interval_multiplier<CacheEntryType, DecimalExponentType, ShiftAmountType>
+                    compute_normal_interval_multiplier(exponent_int, exponent_int binary_exponent,
+                                                       ...) noexcept {
+                    auto const minus_k = DecimalExponentType(
+                        log::floor_log10_pow2<min_exponent - significand_bits,
+                                              max_exponent - significand_bits, DecimalExponentType>(
+                            binary_exponent) -
+                        kappa);
+                    auto const cache = CachePolicy::template get_cache<format, ShiftAmountType>(
+                        DecimalExponentType(-minus_k));
+                    auto const beta = ShiftAmountType(
+                        binary_exponent +
+                        log::floor_log2_pow10<min_k, max_k>(DecimalExponentType(-minus_k)));
+                    return {minus_k, cache, beta};
+                }
+
+                // Cache policies with get_shorter_interval_entry provide the results of the shorter
+                // interval case precomputed for each value of the exponent bits.
+                template <class SignPolicy, class TrailingZeroPolicy, class IntervalTypeProvider,
+                          class BinaryToDecimalRoundingPolicy, class CachePolicy,
+                          class PreferredIntegerTypesPolicy,
+                          class = decltype(CachePolicy::template get_shorter_interval_entry<
+                                           FormatTraits, BinaryToDecimalRoundingPolicy>(
+                              IntervalTypeProvider::shorter_interval(
+                                  declval<signed_significand_bits<FormatTraits>>()),
+                              exponent_int()))>
+                JKJ_FORCEINLINE JKJ_SAFEBUFFERS static JKJ_CONSTEXPR20
+                    return_type<SignPolicy, TrailingZeroPolicy, PreferredIntegerTypesPolicy>
+                    compute_shorter_interval_case(signed_significand_bits<FormatTraits> s,
+                                                  exponent_int exponent_bits, exponent_int,
+                                                  int) noexcept {
+                    using decimal_exponent_type_ = decimal_exponent_type<PreferredIntegerTypesPolicy>;
+
+                    auto const entry = CachePolicy::template get_shorter_interval_entry<
+                        FormatTraits, BinaryToDecimalRoundingPolicy>(
+                        IntervalTypeProvider::shorter_interval(s), exponent_bits);
+                    if (entry.may_have_trailing_zeros) {
+                        auto const result = TrailingZeroPolicy::template on_trailing_zeros<format>(
+                            entry.significand, decimal_exponent_type_(entry.exponent));
+                        JKJ_DRAGONBOX_RECORD_TRAILING_ZEROS(result.exponent - entry.exponent);
+                        return SignPolicy::handle_sign(s, result);
+                    }
+                    return SignPolicy::handle_sign(
+                        s, TrailingZeroPolicy::template no_trailing_zeros<format>(
+                               entry.significand, decimal_exponent_type_(entry.exponent)));
+                }
 
                 template <class SignPolicy, class TrailingZeroPolicy, class IntervalTypeProvider,
                           class BinaryToDecimalRoundingPolicy, class CachePolicy,
                           class PreferredIntegerTypesPolicy>
+                JKJ_COLD_PATH JKJ_SAFEBUFFERS static JKJ_CONSTEXPR20
+                    return_type<SignPolicy, TrailingZeroPolicy, PreferredIntegerTypesPolicy>
+                    compute_shorter_interval_case(signed_significand_bits<FormatTraits> s,
+                                                  exponent_int, exponent_int binary_exponent,
+                                                  ...) noexcept {
+                    using cache_holder_type = typename CachePolicy::template cache_holder_type<format>;
+                    using decimal_exponent_type_ = decimal_exponent_type<PreferredIntegerTypesPolicy>;
+                    using shift_amount_type =
+                        typename PreferredIntegerTypesPolicy::template shift_amount_type<FormatTraits>;
+                    using multiplication_traits_ =
+                        multiplication_traits<FormatTraits,
+                                              typename cache_holder_type::cache_entry_type,
+                                              cache_holder_type::cache_bits>;
+
+                    auto interval_type = IntervalTypeProvider::shorter_interval(s);
+
+                    // Compute k and beta.
+                    auto const minus_k = log::floor_log10_pow2_minus_log10_4_over_3<
+                        min_exponent - format::significand_bits,
+                        max_exponent - format::significand_bits, decimal_exponent_type_>(
+                        binary_exponent);
+                    auto const beta = shift_amount_type(
+                        binary_exponent +
+                        log::floor_log2_pow10<min_k, max_k>(decimal_exponent_type_(-minus_k)));
+
+                    // Compute xi and zi.
+                    auto const cache = CachePolicy::template get_cache<format, shift_amount_type>(
+                        decimal_exponent_type_(-minus_k));
+
+                    auto xi = multiplication_traits_::compute_left_endpoint_for_shorter_interval_case(
+                        cache, beta);
+                    auto zi = multiplication_traits_::compute_right_endpoint_for_shorter_interval_case(
+                        cache, beta);
+
+                    // If we don't accept the right endpoint and
+                    // if the right endpoint is an integer, decrease it.
+                    if (!interval_type.include_right_endpoint() &&
+                        is_right_endpoint_integer_shorter_interval(binary_exponent)) {
+                        --zi;
+                    }
+                    // If we don't accept the left endpoint or
+                    // if the left endpoint is not an integer, increase it.
+                    if (!interval_type.include_left_endpoint() ||
+                        !is_left_endpoint_integer_shorter_interval(binary_exponent)) {
+                        ++xi;
+                    }
+
+                    // Try bigger divisor.
+                    // zi is at most floor((f_c + 1/2) * 2^e * 10^k0).
+                    // Substituting f_c = 2^p and k0 = -floor(log10(3 * 2^(e-2))), we get
+                    // zi <= floor((2^(p+1) + 1) * 20/3) <= ceil((2^(p+1) + 1)/3) * 20.
+                    // This computation does not overflow for any of the formats I care about.
+                    carrier_uint decimal_significand = div::divide_by_pow10<
+                        1, carrier_uint,
+                        carrier_uint(((((carrier_uint(1) << (significand_bits + 1)) + 1) / 3) + 1) *
+                                     20)>(zi);
+
+                    // If succeed, remove trailing zeros if necessary and return.
+                    if (decimal_significand * 10 >= xi) {
+                        auto const result = TrailingZeroPolicy::template on_trailing_zeros<format>(
+                            decimal_significand, decimal_exponent_type_(minus_k + 1));
+                        JKJ_DRAGONBOX_RECORD_TRAILING_ZEROS(result.exponent - (minus_k + 1));
+                        return SignPolicy::handle_sign(s, result);
+                    }
+
+                    // Otherwise, compute the round-up of y.
+                    decimal_significand =
+                        multiplication_traits_::compute_round_up_for_shorter_interval_case(cache, beta);
+
+                    // When tie occurs, choose one of them according to the rule.
+                    if (BinaryToDecimalRoundingPolicy::prefer_round_down(decimal_significand) &&
+                        binary_exponent >= shorter_interval_tie_lower_threshold &&
+                        binary_exponent <= shorter_interval_tie_upper_threshold) {
+                        --decimal_significand;
+                    }
+                    else if (decimal_significand < xi) {
+                        ++decimal_significand;
+                    }
+                    return SignPolicy::handle_sign(
+                        s, TrailingZeroPolicy::template no_trailing_zeros<format>(
+                               decimal_significand, decimal_exponent_type_(minus_k)));
+                }
+
+                // Checks if the input is an integer below 2^(significand_bits + 1). If it is, then
+                // that integer with trailing zeros removed is the result for every rounding mode,
+                // since any other candidate with no more significant digits is an integer at a
+                // distance of at least 1, while the rounding interval is of length at most 1 and
+                // can include both of its endpoints only when the half-length is at most 1/2.
+                JKJ_FORCEINLINE static constexpr bool
+                is_small_integer(signed_significand_bits<FormatTraits> s,
+                                 exponent_int exponent_bits) noexcept {
+                    // The number of bits below the binary point, if in [0, significand_bits].
+                    return carrier_uint(significand_bits - exponent_bits - format::exponent_bias) <=
+                               carrier_uint(significand_bits) &&
+                           (s.remove_sign_bit_and_shift() &
+                            ((carrier_uint(2) << (significand_bits - exponent_bits -
+                                                  format::exponent_bias)) -
+                             1)) == 0;
+                }
+
+                template <class SignPolicy, class TrailingZeroPolicy, class PreferredIntegerTypesPolicy>
+                JKJ_FORCEINLINE static JKJ_CONSTEXPR14
+                    return_type<SignPolicy, TrailingZeroPolicy, PreferredIntegerTypesPolicy>
+                    compute_small_integer(signed_significand_bits<FormatTraits> s,
+                                          exponent_int exponent_bits) noexcept {
+                    using decimal_exponent_type_ = decimal_exponent_type<PreferredIntegerTypesPolicy>;
+                    assert(is_small_integer(s, exponent_bits));
+
+                    auto const decimal_significand = carrier_uint(
+                        (s.remove_sign_bit_and_shift() |
+                         (carrier_uint(1) << (format::significand_bits + 1))) >>
+                        (significand_bits + 1 - exponent_bits - format::exponent_bias));
+                    auto const result = TrailingZeroPolicy::template on_trailing_zeros<format>(
+                        decimal_significand, decimal_exponent_type_(0));
+                    JKJ_DRAGONBOX_RECORD_TRAILING_ZEROS(result.exponent);
+                    return SignPolicy::handle_sign(s, result);
+                }
+
+                //// The main algorithm assumes the input is a normal/subnormal finite number.
+
+                template <class SignPolicy, class TrailingZeroPolicy, class IntervalTypeProvider,
+                          class BinaryToDecimalRoundingPolicy, class CachePolicy,
+                          class PreferredIntegerTypesPolicy, class BranchingPolicy>
                 JKJ_SAFEBUFFERS static JKJ_CONSTEXPR20
                     return_type<SignPolicy, TrailingZeroPolicy, PreferredIntegerTypesPolicy>
                     compute_nearest(signed_significand_bits<FormatTraits> s,
@@ -3481,21 +4488,16 @@ namespace JKJ_NAMESPACE {
                     static_assert(
                         min_k >= cache_holder_type::min_k && max_k <= cache_holder_type::max_k, "");
 
-                    using remainder_type_ = remainder_type<PreferredIntegerTypesPolicy>;
                     using decimal_exponent_type_ = decimal_exponent_type<PreferredIntegerTypesPolicy>;
                     using shift_amount_type =
                         typename PreferredIntegerTypesPolicy::template shift_amount_type<FormatTraits>;
 
-                    using multiplication_traits_ =
-                        multiplication_traits<FormatTraits,
-                                              typename cache_holder_type::cache_entry_type,
-                                              cache_holder_type::cache_bits>;
-
                     auto two_fc = s.remove_sign_bit_and_shift();
                     auto binary_exponent = exponent_bits;
+                    JKJ_DRAGONBOX_RECORD_EVENT(nearest_calls, nearest, exponent_bits);
 
                     // Is the input a normal number?
-                    if (binary_exponent != 0) {
+                    if (JKJ_LIKELY(binary_exponent != 0)) {
                         binary_exponent += format::exponent_bias - format::significand_bits;
 
                         // Shorter interval case; proceed like Schubfach.
@@ -3531,76 +4533,12 @@ namespace JKJ_NAMESPACE {
 
                         // Shorter interval case.
                         if (two_fc == 0) {
-                            auto interval_type = IntervalTypeProvider::shorter_interval(s);
-
-                            // Compute k and beta.
-                            auto const minus_k = log::floor_log10_pow2_minus_log10_4_over_3<
-                                min_exponent - format::significand_bits,
-                                max_exponent - format::significand_bits, decimal_exponent_type_>(
-                                binary_exponent);
-                            auto const beta = shift_amount_type(
-                                binary_exponent +
-                                log::floor_log2_pow10<min_k, max_k>(decimal_exponent_type_(-minus_k)));
-
-                            // Compute xi and zi.
-                            auto const cache =
-                                CachePolicy::template get_cache<format, shift_amount_type>(
-                                    decimal_exponent_type_(-minus_k));
-
-                            auto xi =
-                                multiplication_traits_::compute_left_endpoint_for_shorter_interval_case(
-                                    cache, beta);
-                            auto zi = multiplication_traits_::
-                                compute_right_endpoint_for_shorter_interval_case(cache, beta);
-
-                            // If we don't accept the right endpoint and
-                            // if the right endpoint is an integer, decrease it.
-                            if (!interval_type.include_right_endpoint() &&
-                                is_right_endpoint_integer_shorter_interval(binary_exponent)) {
-                                --zi;
-                            }
-                            // If we don't accept the left endpoint or
-                            // if the left endpoint is not an integer, increase it.
-                            if (!interval_type.include_left_endpoint() ||
-                                !is_left_endpoint_integer_shorter_interval(binary_exponent)) {
-                                ++xi;
-                            }
-
-                            // Try bigger divisor.
-                            // zi is at most floor((f_c + 1/2) * 2^e * 10^k0).
-                            // Substituting f_c = 2^p and k0 = -floor(log10(3 * 2^(e-2))), we get
-                            // zi <= floor((2^(p+1) + 1) * 20/3) <= ceil((2^(p+1) + 1)/3) * 20.
-                            // This computation does not overflow for any of the formats I care about.
-                            carrier_uint decimal_significand = div::divide_by_pow10<
-                                1, carrier_uint,
-                                carrier_uint(
-                                    ((((carrier_uint(1) << (significand_bits + 1)) + 1) / 3) + 1) *
-                                    20)>(zi);
-
-                            // If succeed, remove trailing zeros if necessary and return.
-                            if (decimal_significand * 10 >= xi) {
-                                return SignPolicy::handle_sign(
-                                    s, TrailingZeroPolicy::template on_trailing_zeros<format>(
-                                           decimal_significand, decimal_exponent_type_(minus_k + 1)));
-                            }
-
-                            // Otherwise, compute the round-up of y.
-                            decimal_significand =
-                                multiplication_traits_::compute_round_up_for_shorter_interval_case(
-                                    cache, beta);
-
-                            // When tie occurs, choose one of them according to the rule.
-                            if (BinaryToDecimalRoundingPolicy::prefer_round_down(decimal_significand) &&
-                                binary_exponent >= shorter_interval_tie_lower_threshold &&
-                                binary_exponent <= shorter_interval_tie_upper_threshold) {
-                                --decimal_significand;
-                            }
-                            else if (decimal_significand < xi) {
-                                ++decimal_significand;
-                            }
-                            return SignPolicy::handle_sign(
-                                s, TrailingZeroPolicy::template no_trailing_zeros<format>(
-                                       decimal_significand, decimal_exponent_type_(minus_k)));
+                            JKJ_DRAGONBOX_RECORD_EVENT(shorter_interval_cases,
+                                                       nearest_shorter_interval, exponent_bits);
+                            return compute_shorter_interval_case<
+                                SignPolicy, TrailingZeroPolicy, IntervalTypeProvider,
+                                BinaryToDecimalRoundingPolicy, CachePolicy,
+                                PreferredIntegerTypesPolicy>(s, exponent_bits, binary_exponent, 0);
                         }
 
                         // Normal interval case.
@@ -3616,19 +4554,68 @@ namespace JKJ_NAMESPACE {
                     // Step 1: Schubfach multiplier calculation.
                     //////////////////////////////////////////////////////////////////////
 
+                    // Compute k and beta.
+                    auto const multiplier = compute_normal_interval_multiplier<
+                        CachePolicy, typename cache_holder_type::cache_entry_type,
+                        decimal_exponent_type_, shift_amount_type>(exponent_bits,
+                                                                   binary_exponent, 0);
+                    return compute_nearest_normal_interval<
+                        SignPolicy, TrailingZeroPolicy, IntervalTypeProvider,
+                        BinaryToDecimalRoundingPolicy, CachePolicy, PreferredIntegerTypesPolicy,
+                        BranchingPolicy>(s, exponent_bits, two_fc, multiplier);
+                }
+
+                template <class CachePolicy, class PreferredIntegerTypesPolicy>
+                using nearest_multiplier_type = normal_interval_multiplier<
+                    typename CachePolicy::template cache_holder_type<format>::cache_entry_type,
+                    decimal_exponent_type<PreferredIntegerTypesPolicy>,
+                    typename PreferredIntegerTypesPolicy::template shift_amount_type<FormatTraits>>;
+
+                // Step 1 of compute_nearest for the normal interval case, which only depends on the
+                // exponent bits.
+                template <class CachePolicy, class PreferredIntegerTypesPolicy>
+                JKJ_FORCEINLINE static JKJ_CONSTEXPR20
+                    nearest_multiplier_type<CachePolicy, PreferredIntegerTypesPolicy>
+                    compute_nearest_multiplier(exponent_int exponent_bits) noexcept {
+                    using multiplier_type =
+                        nearest_multiplier_type<CachePolicy, PreferredIntegerTypesPolicy>;
+                    return compute_normal_interval_multiplier<
+                        CachePolicy, decltype(multiplier_type::cache),
+                        decltype(multiplier_type::minus_k), decltype(multiplier_type::beta)>(
+                        exponent_bits,
+                        exponent_bits != 0
+                            ? exponent_int(exponent_bits + format::exponent_bias -
+                                           format::significand_bits)
+                            : exponent_int(format::min_exponent - format::significand_bits),
+                        0);
+                }
+
+                // The rest of compute_nearest for the normal interval case, given two_fc including
+                // the implicit bit and the result of compute_nearest_multiplier.
+                template <class SignPolicy, class TrailingZeroPolicy, class IntervalTypeProvider,
+                          class BinaryToDecimalRoundingPolicy, class CachePolicy,
+                          class PreferredIntegerTypesPolicy, class BranchingPolicy>
+                JKJ_FORCEINLINE JKJ_SAFEBUFFERS static JKJ_CONSTEXPR20
+                    return_type<SignPolicy, TrailingZeroPolicy, PreferredIntegerTypesPolicy>
+                    compute_nearest_normal_interval(
+                        signed_significand_bits<FormatTraits> s, exponent_int exponent_bits,
+                        carrier_uint two_fc,
+                        nearest_multiplier_type<CachePolicy, PreferredIntegerTypesPolicy>
+                            multiplier) noexcept {
+                    using cache_holder_type = typename CachePolicy::template cache_holder_type<format>;
+                    using remainder_type_ = remainder_type<PreferredIntegerTypesPolicy>;
+                    using decimal_exponent_type_ = decimal_exponent_type<PreferredIntegerTypesPolicy>;
+                    using multiplication_traits_ =
+                        multiplication_traits<FormatTraits,
+                                              typename cache_holder_type::cache_entry_type,
+                                              cache_holder_type::cache_bits>;
+                    static_cast<void>(exponent_bits);
+
                     auto interval_type = IntervalTypeProvider::normal_interval(s);
 
-                    // Compute k and beta.
-                    auto const minus_k = decimal_exponent_type_(
-                        log::floor_log10_pow2<min_exponent - format::significand_bits,
-                                              max_exponent - format::significand_bits,
-                                              decimal_exponent_type_>(binary_exponent) -
-                        kappa);
-                    auto const cache = CachePolicy::template get_cache<format, shift_amount_type>(
-                        decimal_exponent_type_(-minus_k));
-                    auto const beta =
-                        shift_amount_type(binary_exponent + log::floor_log2_pow10<min_k, max_k>(
-                                                                decimal_exponent_type_(-minus_k)));
+                    auto const minus_k = multiplier.minus_k;
+                    auto const cache = multiplier.cache;
+                    auto const beta = multiplier.beta;
 
                     // Compute zi and deltai.
                     // 10^kappa <= deltai < 10^(kappa + 1)
@@ -3663,6 +4650,84 @@ namespace JKJ_NAMESPACE {
                         z_result.integer_part);
                     auto r = remainder_type_(z_result.integer_part - big_divisor * decimal_significand);
 
+                    JKJ_IF_CONSTEXPR(BranchingPolicy::tag == policy::branching::tag_t::branchless) {
+                        // Same as below, but the fractional part comparison, the divisibility check
+                        // and the tie-breaking are done regardless of whether they are needed, and
+                        // the conditions are combined into flags instead of being branched on.
+                        auto const x_result = multiplication_traits_::compute_mul_parity(
+                            carrier_uint(two_fc - 1), cache, beta);
+
+                        // Step 2.
+                        bool const exclude_right_endpoint =
+                            (r | remainder_type_(!z_result.is_integer) |
+                             remainder_type_(interval_type.include_right_endpoint())) == 0;
+                        bool const big_divisor_succeeded =
+                            ((r < deltai) & !exclude_right_endpoint) |
+                            ((r == deltai) &
+                             (x_result.parity |
+                              (x_result.is_integer & interval_type.include_left_endpoint())));
+                        auto const big_divisor_significand = decimal_significand;
+
+                        // Step 3.
+                        decimal_significand -= carrier_uint(exclude_right_endpoint);
+                        r = exclude_right_endpoint ? big_divisor : r;
+                        decimal_significand *= 10;
+
+                        JKJ_IF_CONSTEXPR(BinaryToDecimalRoundingPolicy::tag ==
+                                         policy::binary_to_decimal_rounding::tag_t::do_not_care) {
+                            bool const divisible_by_small_divisor =
+                                div::check_divisibility_and_divide_by_pow10<kappa>(r);
+                            decimal_significand += r;
+                            decimal_significand -= carrier_uint(
+                                divisible_by_small_divisor & z_result.is_integer &
+                                !interval_type.include_right_endpoint());
+                        }
+                        else {
+                            // The result is discarded if r < deltai, but dist should not wrap
+                            // around.
+                            r = r < deltai ? deltai : r;
+                            auto dist = remainder_type_(r - (deltai / 2) + (small_divisor / 2));
+                            bool const approx_y_parity = ((dist ^ (small_divisor / 2)) & 1) != 0;
+                            bool const divisible_by_small_divisor =
+                                div::check_divisibility_and_divide_by_pow10<kappa>(dist);
+                            decimal_significand += dist;
+
+                            auto const y_result =
+                                multiplication_traits_::compute_mul_parity(two_fc, cache, beta);
+                            decimal_significand -= carrier_uint(
+                                divisible_by_small_divisor &
+                                ((y_result.parity != approx_y_parity) |
+                                 (BinaryToDecimalRoundingPolicy::prefer_round_down(
+                                      decimal_significand) &
+                                  y_result.is_integer)));
+                        }
+
+                        // Written with a mask rather than ?:, since otherwise compilers tend to
+                        // skip Step 3 with a branch when the larger divisor succeeds.
+                        decimal_significand ^=
+                            (decimal_significand ^ big_divisor_significand) &
+                            carrier_uint(0 - carrier_uint(big_divisor_succeeded));
+                        auto const decimal_exponent = decimal_exponent_type_(
+                            minus_k + kappa + decimal_exponent_type_(big_divisor_succeeded));
+                        auto const result =
+                            big_divisor_succeeded
+                                ? TrailingZeroPolicy::template on_trailing_zeros<format>(
+                                      decimal_significand, decimal_exponent)
+                                : TrailingZeroPolicy::template no_trailing_zeros<format>(
+                                      decimal_significand, decimal_exponent);
+
+                        if (big_divisor_succeeded) {
+                            JKJ_DRAGONBOX_RECORD_EVENT(big_divisor_exits, nearest_big_divisor,
+                                                       exponent_bits);
+                            JKJ_DRAGONBOX_RECORD_TRAILING_ZEROS(result.exponent - decimal_exponent);
+                        }
+                        else {
+                            JKJ_DRAGONBOX_RECORD_EVENT(small_divisor_cases, nearest_small_divisor,
+                                                       exponent_bits);
+                        }
+                        return SignPolicy::handle_sign(s, result);
+                    }
+
                     do {
                         if (r < deltai) {
                             // Exclude the right endpoint if necessary.
@@ -3671,6 +4736,10 @@ namespace JKJ_NAMESPACE {
                                 JKJ_IF_CONSTEXPR(
                                     BinaryToDecimalRoundingPolicy::tag ==
                                     policy::binary_to_decimal_rounding::tag_t::do_not_care) {
+                                    // The result is in terms of the smaller divisor, so this
+                                    // is counted as in Step 3, as the branchless kernel does.
+                                    JKJ_DRAGONBOX_RECORD_EVENT(small_divisor_cases,
+                                                               nearest_small_divisor, exponent_bits);
                                     decimal_significand *= 10;
                                     --decimal_significand;
                                     return SignPolicy::handle_sign(
@@ -3700,9 +4769,12 @@ namespace JKJ_NAMESPACE {
                         }
 
                         // We may need to remove trailing zeros.
-                        return SignPolicy::handle_sign(
-                            s, TrailingZeroPolicy::template on_trailing_zeros<format>(
-                                   decimal_significand, decimal_exponent_type_(minus_k + kappa + 1)));
+                        JKJ_DRAGONBOX_RECORD_EVENT(big_divisor_exits, nearest_big_divisor,
+                                                   exponent_bits);
+                        auto const result = TrailingZeroPolicy::template on_trailing_zeros<format>(
+                            decimal_significand, decimal_exponent_type_(minus_k + kappa + 1));
+                        JKJ_DRAGONBOX_RECORD_TRAILING_ZEROS(result.exponent - (minus_k + kappa + 1));
+                        return SignPolicy::handle_sign(s, result);
                     } while (false);
 
 
@@ -3710,6 +4782,8 @@ namespace JKJ_NAMESPACE {
                     // Step 3: Find the significand with the smaller divisor.
                     //////////////////////////////////////////////////////////////////////
 
+                    JKJ_DRAGONBOX_RECORD_EVENT(small_divisor_cases, nearest_small_divisor,
+                                               exponent_bits);
                     decimal_significand *= 10;
 
                     JKJ_IF_CONSTEXPR(BinaryToDecimalRoundingPolicy::tag ==
@@ -3798,6 +4872,8 @@ namespace JKJ_NAMESPACE {
 
                     auto two_fc = s.remove_sign_bit_and_shift();
                     auto binary_exponent = exponent_bits;
+                    JKJ_DRAGONBOX_RECORD_EVENT(left_closed_directed_calls, left_closed_directed,
+                                               exponent_bits);
 
                     // Is the input a normal number?
                     if (binary_exponent != 0) {
@@ -3814,16 +4890,13 @@ namespace JKJ_NAMESPACE {
                     //////////////////////////////////////////////////////////////////////
 
                     // Compute k and beta.
-                    auto const minus_k = decimal_exponent_type_(
-                        log::floor_log10_pow2<format::min_exponent - format::significand_bits,
-                                              format::max_exponent - format::significand_bits,
-                                              decimal_exponent_type_>(binary_exponent) -
-                        kappa);
-                    auto const cache = CachePolicy::template get_cache<format, shift_amount_type>(
-                        decimal_exponent_type_(-minus_k));
-                    auto const beta =
-                        shift_amount_type(binary_exponent + log::floor_log2_pow10<min_k, max_k>(
-                                                                decimal_exponent_type_(-minus_k)));
+                    auto const multiplier = compute_normal_interval_multiplier<
+                        CachePolicy, typename cache_holder_type::cache_entry_type,
+                        decimal_exponent_type_, shift_amount_type>(exponent_bits,
+                                                                   binary_exponent, 0);
+                    auto const minus_k = multiplier.minus_k;
+                    auto const cache = multiplier.cache;
+                    auto const beta = multiplier.beta;
 
                     // Compute xi and deltai.
                     // 10^kappa <= deltai < 10^(kappa + 1)
@@ -3879,11 +4952,12 @@ namespace JKJ_NAMESPACE {
                             // 10^-18) and 2f_c = 29711482, e = -80
                             // (1.2288529832819387448703332688104694625508273020386695861816... *
                             // 10^-17).
-                            // For the case of compressed cache for binary32, there is another
-                            // exceptional case 2f_c = 33554430, e = -10 (16383.9990234375). In this
-                            // case, the recovered cache is two large to make compute_mul_parity
-                            // mistakenly conclude that z is not an integer, but actually z = 16384 is
-                            // an integer.
+                            // For the case of compressed cache for binary32 with the default
+                            // compression ratio, there is another exceptional case
+                            // 2f_c = 33554430, e = -10 (16383.9990234375). In this case, the
+                            // recovered cache is two large to make compute_mul_parity mistakenly
+                            // conclude that z is not an integer, but actually z = 16384 is an
+                            // integer.
                             JKJ_IF_CONSTEXPR(
                                 stdr::is_same<cache_holder_type,
                                               compressed_cache_holder<ieee754_binary32>>::value) {
@@ -3899,9 +4973,12 @@ namespace JKJ_NAMESPACE {
                         }
 
                         // The ceiling is inside, so we are done.
-                        return SignPolicy::handle_sign(
-                            s, TrailingZeroPolicy::template on_trailing_zeros<format>(
-                                   decimal_significand, decimal_exponent_type_(minus_k + kappa + 1)));
+                        JKJ_DRAGONBOX_RECORD_EVENT(big_divisor_exits, left_closed_big_divisor,
+                                                   exponent_bits);
+                        auto const result = TrailingZeroPolicy::template on_trailing_zeros<format>(
+                            decimal_significand, decimal_exponent_type_(minus_k + kappa + 1));
+                        JKJ_DRAGONBOX_RECORD_TRAILING_ZEROS(result.exponent - (minus_k + kappa + 1));
+                        return SignPolicy::handle_sign(s, result);
                     } while (false);
 
 
@@ -3909,6 +4986,8 @@ namespace JKJ_NAMESPACE {
                     // Step 3: Find the significand with the smaller divisor.
                     //////////////////////////////////////////////////////////////////////
 
+                    JKJ_DRAGONBOX_RECORD_EVENT(small_divisor_cases, left_closed_small_divisor,
+                                               exponent_bits);
                     decimal_significand *= 10;
                     decimal_significand -= div::small_division_by_pow10<kappa>(r);
                     return SignPolicy::handle_sign(
@@ -3938,6 +5017,8 @@ namespace JKJ_NAMESPACE {
 
                     auto two_fc = s.remove_sign_bit_and_shift();
                     auto binary_exponent = exponent_bits;
+                    JKJ_DRAGONBOX_RECORD_EVENT(right_closed_directed_calls, right_closed_directed,
+                                               exponent_bits);
                     bool shorter_interval = false;
 
                     // Is the input a normal number?
@@ -4007,9 +5088,12 @@ namespace JKJ_NAMESPACE {
                         }
 
                         // The floor is inside, so we are done.
-                        return SignPolicy::handle_sign(
-                            s, TrailingZeroPolicy::template on_trailing_zeros<format>(
-                                   decimal_significand, decimal_exponent_type_(minus_k + kappa + 1)));
+                        JKJ_DRAGONBOX_RECORD_EVENT(big_divisor_exits, right_closed_big_divisor,
+                                                   exponent_bits);
+                        auto const result = TrailingZeroPolicy::template on_trailing_zeros<format>(
+                            decimal_significand, decimal_exponent_type_(minus_k + kappa + 1));
+                        JKJ_DRAGONBOX_RECORD_TRAILING_ZEROS(result.exponent - (minus_k + kappa + 1));
+                        return SignPolicy::handle_sign(s, result);
                     } while (false);
 
 
@@ -4017,6 +5101,8 @@ namespace JKJ_NAMESPACE {
                     // Step 3: Find the significand with the small divisor.
                     //////////////////////////////////////////////////////////////////////
 
+                    JKJ_DRAGONBOX_RECORD_EVENT(small_divisor_cases, right_closed_small_divisor,
+                                               exponent_bits);
                     decimal_significand *= 10;
                     decimal_significand += div::small_division_by_pow10<kappa>(r);
                     return SignPolicy::handle_sign(
@@ -4037,6 +5123,137 @@ namespace JKJ_NAMESPACE {
                 }
             };
 
+            // Results of the shorter interval case for the given endpoint inclusion, indexed by the
+            // exponent bits. The entries for the exponent bits of subnormals, infinities and NaNs
+            // are unused.
+            template <class FormatTraits, bool IncludeLeftEndpoint, bool IncludeRightEndpoint,
+                      class BinaryToDecimalRoundingPolicy, class Dummy = void>
+            struct shorter_interval_table_holder {
+                using impl_type = impl<FormatTraits>;
+                using format = typename FormatTraits::format;
+                using carrier_uint = typename FormatTraits::carrier_uint;
+                using full_holder = cache_holder<format>;
+                using multiplication_traits_ =
+                    multiplication_traits<FormatTraits, typename full_holder::cache_entry_type,
+                                          full_holder::cache_bits>;
+                using entry_type = shorter_interval_entry<carrier_uint>;
+
+                static constexpr stdr::size_t table_size = stdr::size_t(1) << format::exponent_bits;
+                using table_t = array<entry_type, table_size>;
+
+                // Same as the shorter interval case of the main algorithm.
+                static JKJ_CONSTEXPR14 entry_type make_entry(stdr::size_t exponent_bits) noexcept {
+                    if (exponent_bits == 0 || exponent_bits == table_size - 1) {
+                        return {};
+                    }
+
+                    auto const binary_exponent =
+                        int(exponent_bits) + format::exponent_bias - format::significand_bits;
+                    auto const minus_k = log::floor_log10_pow2_minus_log10_4_over_3(binary_exponent);
+                    auto const beta = binary_exponent + log::floor_log2_pow10(-minus_k);
+                    auto const cache = full_holder::cache[stdr::size_t(-minus_k - full_holder::min_k)];
+
+                    auto xi =
+                        multiplication_traits_::compute_left_endpoint_for_shorter_interval_case(
+                            cache, beta);
+                    auto zi =
+                        multiplication_traits_::compute_right_endpoint_for_shorter_interval_case(
+                            cache, beta);
+                    if (!IncludeRightEndpoint &&
+                        impl_type::is_right_endpoint_integer_shorter_interval(binary_exponent)) {
+                        --zi;
+                    }
+                    if (!IncludeLeftEndpoint ||
+                        !impl_type::is_left_endpoint_integer_shorter_interval(binary_exponent)) {
+                        ++xi;
+                    }
+
+                    carrier_uint decimal_significand = zi / 10;
+                    if (decimal_significand * 10 >= xi) {
+                        return {decimal_significand, stdr::int_least16_t(minus_k + 1), true};
+                    }
+
+                    decimal_significand =
+                        multiplication_traits_::compute_round_up_for_shorter_interval_case(cache,
+                                                                                           beta);
+                    if (BinaryToDecimalRoundingPolicy::prefer_round_down(decimal_significand) &&
+                        binary_exponent >= impl_type::shorter_interval_tie_lower_threshold &&
+                        binary_exponent <= impl_type::shorter_interval_tie_upper_threshold) {
+                        --decimal_significand;
+                    }
+                    else if (decimal_significand < xi) {
+                        ++decimal_significand;
+                    }
+                    return {decimal_significand, stdr::int_least16_t(minus_k), false};
+                }
+
+    #if JKJ_HAS_CONSTEXPR17
+                static constexpr table_t table JKJ_STATIC_DATA_SECTION = [] {
+                    table_t res{};
+                    for (stdr::size_t i = 0; i < table_size; ++i) {
+                        res[i] = make_entry(i);
+                    }
+                    return res;
+                }();
+
+                static JKJ_CONSTEXPR20 entry_type get_entry(stdr::size_t exponent_bits) noexcept {
+                    return read_static_data(table.data() + exponent_bits);
+                }
+    #else
+                // The table is too large to be generated with index_sequence, so it is filled
+                // when it is used for the first time.
+                static table_t make_table() noexcept {
+                    table_t res{};
+                    for (stdr::size_t i = 0; i < table_size; ++i) {
+                        res[i] = make_entry(i);
+                    }
+                    return res;
+                }
+
+                static entry_type get_entry(stdr::size_t exponent_bits) noexcept {
+                    static table_t const table = make_table();
+                    return table[exponent_bits];
+                }
+    #endif
+            };
+    #if JKJ_HAS_CONSTEXPR17 && !JKJ_HAS_INLINE_VARIABLE
+            template <class FormatTraits, bool IncludeLeftEndpoint, bool IncludeRightEndpoint,
+                      class BinaryToDecimalRoundingPolicy, class Dummy>
+            constexpr typename shorter_interval_table_holder<FormatTraits, IncludeLeftEndpoint,
+                                                             IncludeRightEndpoint,
+                                                             BinaryToDecimalRoundingPolicy,
+                                                             Dummy>::table_t
+                shorter_interval_table_holder<FormatTraits, IncludeLeftEndpoint,
+                                              IncludeRightEndpoint, BinaryToDecimalRoundingPolicy,
+                                              Dummy>::table;
+    #endif
+
+            template <class FormatTraits, class BinaryToDecimalRoundingPolicy>
+            struct shorter_interval_table {
+                template <bool IncludeLeftEndpoint, bool IncludeRightEndpoint>
+                using holder =
+                    shorter_interval_table_holder<FormatTraits, IncludeLeftEndpoint,
+                                                  IncludeRightEndpoint, BinaryToDecimalRoundingPolicy>;
+                using entry_type = shorter_interval_entry<typename FormatTraits::carrier_uint>;
+
+                // Interval types with static boundaries select the table at compile time.
+                template <class IntervalType>
+                static JKJ_CONSTEXPR20 entry_type get_entry(IntervalType,
+                                                            stdr::size_t exponent_bits) noexcept {
+                    return holder<IntervalType::include_left_endpoint(),
+                                  IntervalType::include_right_endpoint()>::get_entry(exponent_bits);
+                }
+
+                static JKJ_CONSTEXPR20 entry_type
+                get_entry(policy::decimal_to_binary_rounding::interval_type::asymmetric_boundary
+                              interval_type,
+                          stdr::size_t exponent_bits) noexcept {
+                    return interval_type.is_left_closed
+                               ? holder<true, false>::get_entry(exponent_bits)
+                               : holder<false, true>::get_entry(exponent_bits);
+                }
+            };
+
 
             ////////////////////////////////////////////////////////////////////////////////////////
             // Policy holder.
@@ -4293,6 +5510,20 @@ namespace JKJ_NAMESPACE {
                     return true;
                 }
             };
+            struct is_branching_policy {
+                constexpr bool operator()(...) noexcept { return false; }
+                template <class Policy, class = typename Policy::branching_policy>
+                constexpr bool operator()(dummy<Policy>) noexcept {
+                    return true;
+                }
+            };
+            struct is_integer_fast_path_policy {
+                constexpr bool operator()(...) noexcept { return false; }
+                template <class Policy, class = typename Policy::integer_fast_path_policy>
+                constexpr bool operator()(dummy<Policy>) noexcept {
+                    return true;
+                }
+            };
 
             template <class... Policies>
             using to_decimal_policy_holder = make_policy_holder<
@@ -4305,7 +5536,10 @@ namespace JKJ_NAMESPACE {
                                           policy::binary_to_decimal_rounding::to_even_t>,
                     detector_default_pair<is_cache_policy, policy::cache::full_t>,
                     detector_default_pair<is_preferred_integer_types_policy,
-                                          policy::preferred_integer_types::match_t>>,
+                                          policy::preferred_integer_types::match_t>,
+                    detector_default_pair<is_branching_policy, policy::branching::branchy_t>,
+                    detector_default_pair<is_integer_fast_path_policy,
+                                          policy::integer_fast_path::disabled_t>>,
                 Policies...>;
 
             template <class FormatTraits, class... Policies>
@@ -4323,6 +5557,8 @@ namespace JKJ_NAMESPACE {
                 using cache_policy = typename PolicyHolder::cache_policy;
                 using preferred_integer_types_policy =
                     typename PolicyHolder::preferred_integer_types_policy;
+                using branching_policy = typename PolicyHolder::branching_policy;
+                using integer_fast_path_policy = typename PolicyHolder::integer_fast_path_policy;
                 using return_type =
                     typename impl<FormatTraits>::template return_type<sign_policy, trailing_zero_policy,
                                                                       preferred_integer_types_policy>;
@@ -4333,11 +5569,19 @@ namespace JKJ_NAMESPACE {
                            typename FormatTraits::exponent_int exponent_bits) noexcept {
                     constexpr auto tag = IntervalTypeProvider::tag;
 
+                    JKJ_IF_CONSTEXPR(integer_fast_path_policy::detect_integers) {
+                        if (impl<FormatTraits>::is_small_integer(s, exponent_bits)) {
+                            return impl<FormatTraits>::template compute_small_integer<
+                                sign_policy, trailing_zero_policy, preferred_integer_types_policy>(
+                                s, exponent_bits);
+                        }
+                    }
+
                     JKJ_IF_CONSTEXPR(tag == policy::decimal_to_binary_rounding::tag_t::to_nearest) {
                         return impl<FormatTraits>::template compute_nearest<
                             sign_policy, trailing_zero_policy, IntervalTypeProvider,
                             binary_to_decimal_rounding_policy, cache_policy,
-                            preferred_integer_types_policy>(s, exponent_bits);
+                            preferred_integer_types_policy, branching_policy>(s, exponent_bits);
                     }
                     else JKJ_IF_CONSTEXPR(
                         tag == policy::decimal_to_binary_rounding::tag_t::left_closed_directed) {
@@ -4391,6 +5635,183 @@ namespace JKJ_NAMESPACE {
 
             return to_decimal_ex(s, exponent_bits, policies...);
         }
+
+        namespace detail {
+            // Runs compute_nearest_normal_interval with the interval type provider selected by the
+            // decimal-to-binary rounding policy, which may depend on the sign.
+            template <class FormatTraits, class PolicyHolder>
+            struct to_decimal_run_dispatcher {
+                using sign_policy = typename PolicyHolder::sign_policy;
+                using trailing_zero_policy = typename PolicyHolder::trailing_zero_policy;
+                using binary_to_decimal_rounding_policy =
+                    typename PolicyHolder::binary_to_decimal_rounding_policy;
+                using cache_policy = typename PolicyHolder::cache_policy;
+                using preferred_integer_types_policy =
+                    typename PolicyHolder::preferred_integer_types_policy;
+                using branching_policy = typename PolicyHolder::branching_policy;
+                using return_type =
+                    typename impl<FormatTraits>::template return_type<sign_policy, trailing_zero_policy,
+                                                                      preferred_integer_types_policy>;
+                using multiplier_type = typename impl<FormatTraits>::template nearest_multiplier_type<
+                    cache_policy, preferred_integer_types_policy>;
+
+                template <class IntervalTypeProvider>
+                JKJ_FORCEINLINE JKJ_SAFEBUFFERS JKJ_CONSTEXPR20 return_type
+                operator()(IntervalTypeProvider, signed_significand_bits<FormatTraits> s,
+                           typename FormatTraits::exponent_int exponent_bits,
+                           typename FormatTraits::carrier_uint two_fc,
+                           multiplier_type multiplier) noexcept {
+                    return impl<FormatTraits>::template compute_nearest_normal_interval<
+                        sign_policy, trailing_zero_policy, IntervalTypeProvider,
+                        binary_to_decimal_rounding_policy, cache_policy,
+                        preferred_integer_types_policy, branching_policy>(s, exponent_bits, two_fc,
+                                                                          multiplier);
+                }
+            };
+
+            template <bool reuse_multiplier>
+            struct to_decimal_batch_impl {
+                template <class Float, class ConversionTraits, class FormatTraits, class Result,
+                          class... Policies>
+                static JKJ_CONSTEXPR20 Result* compute(Float const* first, Float const* last,
+                                                       Result* output, Policies... policies) noexcept {
+                    for (; first != last; ++first, ++output) {
+                        *output = to_decimal<Float, ConversionTraits, FormatTraits>(*first,
+                                                                                    policies...);
+                    }
+                    return output;
+                }
+            };
+
+            template <>
+            struct to_decimal_batch_impl<true> {
+                template <class Float, class ConversionTraits, class FormatTraits, class Result,
+                          class... Policies>
+                JKJ_SAFEBUFFERS static JKJ_CONSTEXPR20 Result*
+                compute(Float const* first, Float const* last, Result* output,
+                        Policies... policies) noexcept {
+                    using policy_holder = to_decimal_policy_holder<Policies...>;
+                    using run_dispatcher = to_decimal_run_dispatcher<FormatTraits, policy_holder>;
+                    using format = typename FormatTraits::format;
+                    using carrier_uint = typename FormatTraits::carrier_uint;
+                    using exponent_int = typename FormatTraits::exponent_int;
+
+                    // Never equal to the exponent bits of a finite input.
+                    auto run_exponent_bits = exponent_int(-1);
+                    typename run_dispatcher::multiplier_type multiplier{};
+
+                    for (; first != last; ++first, ++output) {
+                        auto const br = make_float_bits<Float, ConversionTraits, FormatTraits>(*first);
+                        auto const exponent_bits = br.extract_exponent_bits();
+                        auto const s = br.remove_exponent_bits();
+                        assert(br.is_finite() && br.is_nonzero());
+
+                        // The shorter interval case and the integer fast path do not use the
+                        // multiplier.
+                        auto two_fc = s.remove_sign_bit_and_shift();
+                        if ((exponent_bits != 0 && two_fc == 0) ||
+                            (policy_holder::integer_fast_path_policy::detect_integers &&
+                             impl<FormatTraits>::is_small_integer(s, exponent_bits))) {
+                            *output = to_decimal_ex(s, exponent_bits, policies...);
+                            continue;
+                        }
+                        if (exponent_bits != 0) {
+                            two_fc |= (carrier_uint(1) << (format::significand_bits + 1));
+                        }
+
+                        if (exponent_bits != run_exponent_bits) {
+                            run_exponent_bits = exponent_bits;
+                            multiplier = impl<FormatTraits>::template compute_nearest_multiplier<
+                                typename policy_holder::cache_policy,
+                                typename policy_holder::preferred_integer_types_policy>(
+                                exponent_bits);
+                        }
+
+                        JKJ_DRAGONBOX_RECORD_EVENT(nearest_calls, nearest, exponent_bits);
+                        *output = policy_holder::delegate(s, run_dispatcher{}, s, exponent_bits,
+                                                          two_fc, multiplier);
+                    }
+                    return output;
+                }
+            };
+
+            // Selects the implementation above from the interval type provider that the
+            // decimal-to-binary rounding policy delegates to.
+            struct to_decimal_batch_selector {
+                template <class IntervalTypeProvider>
+                constexpr to_decimal_batch_impl<IntervalTypeProvider::tag ==
+                                                policy::decimal_to_binary_rounding::tag_t::to_nearest>
+                operator()(IntervalTypeProvider) const noexcept {
+                    return {};
+                }
+            };
+        }
+
+        // Same as storing to_decimal(x, policies...) into output for each x in [first, last), in
+        // order, and returns the end of the output. Every input should be finite and nonzero. Each
+        // input with the same exponent bits as the previous one reuses k, beta and the cache entry
+        // computed for that one, so a run of such inputs, e.g., a column of values within a narrow
+        // range such as [16, 32), mostly skips the first step of the algorithm. This is done only for
+        // the round-to-nearest decimal-to-binary rounding policies.
+        template <class Float,
+                  class ConversionTraits = default_float_bit_carrier_conversion_traits<Float>,
+                  class FormatTraits = ieee754_binary_traits<typename ConversionTraits::format,
+                                                             typename ConversionTraits::carrier_uint>,
+                  class... Policies>
+        JKJ_CONSTEXPR20 detail::to_decimal_return_type<FormatTraits, Policies...>*
+        to_decimal_batch(Float const* first, Float const* last,
+                         detail::to_decimal_return_type<FormatTraits, Policies...>* output,
+                         Policies... policies) noexcept {
+            using policy_holder = detail::to_decimal_policy_holder<Policies...>;
+            using batch_impl = decltype(policy_holder::delegate(
+                detail::declval<signed_significand_bits<FormatTraits>>(),
+                detail::to_decimal_batch_selector{}));
+            return batch_impl::template compute<Float, ConversionTraits, FormatTraits>(
+                first, last, output, policies...);
+        }
+
+    #if JKJ_DRAGONBOX_EXTERN_TEMPLATES
+        namespace detail {
+            // See the description of JKJ_DRAGONBOX_EXTERN_TEMPLATES above. The first one of each
+            // pair is for to_decimal, and the second one is for to_chars_n.
+            using extern_binary32_traits =
+                ieee754_binary_traits<ieee754_binary32, stdr::uint_least32_t>;
+            using extern_binary64_traits =
+                ieee754_binary_traits<ieee754_binary64, stdr::uint_least64_t>;
+
+            extern template to_decimal_return_type<extern_binary32_traits>
+            impl<extern_binary32_traits>::compute_nearest<
+                policy::sign::return_sign_t, policy::trailing_zero::remove_t,
+                policy::decimal_to_binary_rounding::nearest_to_even_t,
+                policy::binary_to_decimal_rounding::to_even_t, policy::cache::full_t,
+                policy::preferred_integer_types::match_t, policy::branching::branchy_t>(
+                signed_significand_bits<extern_binary32_traits>, int) noexcept;
+            extern template to_decimal_return_type<extern_binary32_traits, policy::sign::ignore_t,
+                                                   policy::trailing_zero::ignore_t>
+            impl<extern_binary32_traits>::compute_nearest<
+                policy::sign::ignore_t, policy::trailing_zero::ignore_t,
+                policy::decimal_to_binary_rounding::nearest_to_even_t,
+                policy::binary_to_decimal_rounding::to_even_t, policy::cache::full_t,
+                policy::preferred_integer_types::match_t, policy::branching::branchy_t>(
+                signed_significand_bits<extern_binary32_traits>, int) noexcept;
+
+            extern template to_decimal_return_type<extern_binary64_traits>
+            impl<extern_binary64_traits>::compute_nearest<
+                policy::sign::return_sign_t, policy::trailing_zero::remove_t,
+                policy::decimal_to_binary_rounding::nearest_to_even_t,
+                policy::binary_to_decimal_rounding::to_even_t, policy::cache::full_t,
+                policy::preferred_integer_types::match_t, policy::branching::branchy_t>(
+                signed_significand_bits<extern_binary64_traits>, int) noexcept;
+            extern template to_decimal_return_type<extern_binary64_traits, policy::sign::ignore_t,
+                                                   policy::trailing_zero::ignore_t>
+            impl<extern_binary64_traits>::compute_nearest<
+                policy::sign::ignore_t, policy::trailing_zero::ignore_t,
+                policy::decimal_to_binary_rounding::nearest_to_even_t,
+                policy::binary_to_decimal_rounding::to_even_t, policy::cache::full_t,
+                policy::preferred_integer_types::match_t, policy::branching::branchy_t>(
+                signed_significand_bits<extern_binary64_traits>, int) noexcept;
+        }
+    #endif
     }
 }
 
@@ -4399,7 +5820,13 @@ namespace JKJ_NAMESPACE {
 #ifdef JKJ_DRAGONBOX_LEAK_MACROS
     #define JKJ_DRAGONBOX_MACROS_DEFINED
 #else
+    #undef JKJ_DRAGONBOX_RECORD_TRAILING_ZEROS
+    #undef JKJ_DRAGONBOX_RECORD_EVENT
+    #undef JKJ_DRAGONBOX_USDT_PROBE
+    #undef JKJ_DRAGONBOX_STATS_ADD
     #undef JKJ_HAS_BUILTIN
+    #undef JKJ_LIKELY
+    #undef JKJ_COLD_PATH
     #undef JKJ_FORCEINLINE
     #undef JKJ_SAFEBUFFERS
     #undef JKJ_CONSTEXPR20
@@ -4416,6 +5843,36 @@ namespace JKJ_NAMESPACE {
     #undef JKJ_CONSTEXPR14
     #undef JKJ_HAS_CONSTEXPR14
     #undef JKJ_HAS_VARIABLE_TEMPLATES
+    #if JKJ_DRAGONBOX_SPLIT_COLD_PATHS_DEFINED
+        #undef JKJ_DRAGONBOX_SPLIT_COLD_PATHS_DEFINED
+    #else
+        #undef JKJ_DRAGONBOX_SPLIT_COLD_PATHS
+    #endif
+    #if JKJ_DRAGONBOX_TABLE_API_DEFINED
+        #undef JKJ_DRAGONBOX_TABLE_API_DEFINED
+    #else
+        #undef JKJ_DRAGONBOX_TABLE_API
+    #endif
+    #if JKJ_DRAGONBOX_SHARED_TABLES_DEFINED
+        #undef JKJ_DRAGONBOX_SHARED_TABLES_DEFINED
+    #else
+        #undef JKJ_DRAGONBOX_SHARED_TABLES
+    #endif
+    #if JKJ_DRAGONBOX_EXTERN_TEMPLATES_DEFINED
+        #undef JKJ_DRAGONBOX_EXTERN_TEMPLATES_DEFINED
+    #else
+        #undef JKJ_DRAGONBOX_EXTERN_TEMPLATES
+    #endif
+    #if JKJ_DRAGONBOX_ENABLE_USDT_PROBES_DEFINED
+        #undef JKJ_DRAGONBOX_ENABLE_USDT_PROBES_DEFINED
+    #else
+        #undef JKJ_DRAGONBOX_ENABLE_USDT_PROBES
+    #endif
+    #if JKJ_DRAGONBOX_ENABLE_STATS_DEFINED
+        #undef JKJ_DRAGONBOX_ENABLE_STATS_DEFINED
+    #else
+        #undef JKJ_DRAGONBOX_ENABLE_STATS
+    #endif
     #if JKJ_FAST_MUL64_DEFINED
         #undef JKJ_FAST_MUL64_DEFINED
     #else
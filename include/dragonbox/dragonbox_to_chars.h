@@ -21,11 +21,39 @@
 #define JKJ_DRAGONBOX_LEAK_MACROS
 #include "dragonbox.h"
 
+// If JKJ_DRAGONBOX_TO_CHARS_HEADER_ONLY is defined to be 1, the digit printers (the definitions in
+// dragonbox_to_chars_impl.h) are defined inline in this header, so that they can be inlined into
+// the caller without LTO and there is no need to link against dragonbox_to_chars. The entry
+// points in the runtime namespace and the runtime ISA dispatch are not available in this mode.
+#ifndef JKJ_DRAGONBOX_TO_CHARS_HEADER_ONLY
+    #define JKJ_DRAGONBOX_TO_CHARS_HEADER_ONLY 0
+#else
+    #define JKJ_DRAGONBOX_TO_CHARS_HEADER_ONLY_DEFINED 1
+#endif
+
+#if JKJ_DRAGONBOX_TO_CHARS_HEADER_ONLY
+    #define JKJ_DRAGONBOX_TO_CHARS_INLINE inline
+#else
+    #define JKJ_DRAGONBOX_TO_CHARS_INLINE
+#endif
+
+// Whether each floating-point operation is correctly rounded to the type of its operands, which
+// policy::digit_generation::short_decimal_first relies on. This excludes x87 excess precision and
+// fast-math modes. The default rounding mode is additionally assumed at runtime.
+#if ((defined(__FLT_EVAL_METHOD__) && __FLT_EVAL_METHOD__ == 0) ||                                \
+     (defined(_MSC_VER) && (defined(_M_X64) || defined(_M_ARM64)))) &&                             \
+    !defined(__FAST_MATH__) && !defined(_M_FP_FAST)
+    #define JKJ_HAS_STRICT_FLOAT_EVALUATION 1
+#else
+    #define JKJ_HAS_STRICT_FLOAT_EVALUATION 0
+#endif
+
 namespace JKJ_NAMESPACE {
     namespace dragonbox {
         namespace detail {
             template <class FloatFormat, class CarrierUInt>
-            extern char* to_chars(CarrierUInt significand, int exponent, char* buffer) noexcept;
+            JKJ_DRAGONBOX_TO_CHARS_INLINE char* to_chars(CarrierUInt significand, int exponent,
+                                                         char* buffer) noexcept;
 
             // Implementation detail of to_chars_naive, which gets called in constexpr context or when
             // the digit_generation policy is set to be "compact". Unlike to_chars above, to_chars_naive
@@ -113,6 +141,8 @@ namespace JKJ_NAMESPACE {
                     }
                 };
 
+                // The fast integer types may be wider than the nominal width, so low() masks
+                // explicitly.
                 template <stdr::size_t tier>
                 struct div_by_10_info;
                 template <>
@@ -125,7 +155,7 @@ namespace JKJ_NAMESPACE {
                         return stdr::uint_fast8_t(n >> 8);
                     }
                     static constexpr stdr::uint_fast8_t low(wide_type n) noexcept {
-                        return stdr::uint_fast8_t(n);
+                        return stdr::uint_fast8_t(n & 0xff);
                     }
                 };
                 template <>
@@ -138,7 +168,7 @@ namespace JKJ_NAMESPACE {
                         return stdr::uint_fast16_t(n >> 16);
                     }
                     static constexpr stdr::uint_fast16_t low(wide_type n) noexcept {
-                        return stdr::uint_fast16_t(n);
+                        return stdr::uint_fast16_t(n & 0xffff);
                     }
                 };
                 template <>
@@ -151,7 +181,7 @@ namespace JKJ_NAMESPACE {
                         return stdr::uint_fast32_t(n >> 32);
                     }
                     static constexpr stdr::uint_fast32_t low(wide_type n) noexcept {
-                        return stdr::uint_fast32_t(n);
+                        return stdr::uint_fast32_t(n & UINT32_C(0xffffffff));
                     }
                 };
                 template <stdr::uint_least64_t max_number, class UInt>
@@ -237,20 +267,117 @@ namespace JKJ_NAMESPACE {
             }
         }
 
+        namespace detail {
+            // Support for policy::digit_generation::short_decimal_first. For a positive normal number
+            // x with 2^e <= x < 2^(e+1), let k = floor(log10(2^(e+1))) so that x < 10^(k+1), and let
+            // d = P - 1 - k for a fixed P. The candidate c * 10^-d is obtained by rounding x * 10^d to
+            // an integer c in floating-point arithmetic, and is accepted if c < 10^P and c / 10^d
+            // evaluates back to x, that is, if c * 10^-d lies inside the rounding interval of x under
+            // nearest_to_even. The interval is of length at most ulp(x) < 10^(k+1) * 2^-q, where q is
+            // the number of significand bits, so if 10^P * 2^-q < 1 it contains no other multiple of
+            // 10^-d. Since c >= 10^(P-1) / 2, any decimal in the interval without more significant
+            // digits than c is such a multiple: its leading digit could only be lower than that of
+            // c * 10^-d if the interval contained the power of 10 in between, which then must be
+            // c * 10^-d itself, leaving a gap of at least 10^-d to any one-digit decimal below it.
+            // Hence c * 10^-d is the unique shortest decimal in the interval, which is what
+            // to_decimal returns regardless of the binary-to-decimal rounding policy.
+            template <class FormatTraits>
+            struct short_decimal_traits {
+                static constexpr bool enabled = false;
+            };
+
+            // P = 6, since 10^6 * 2^-23 < 1/8.
+            template <>
+            struct short_decimal_traits<ieee754_binary_traits<ieee754_binary32, stdr::uint_least32_t>> {
+                using float_type = float;
+                static constexpr bool enabled = JKJ_HAS_STRICT_FLOAT_EVALUATION &&
+                                                stdr::numeric_limits<float>::is_iec559 &&
+                                                physical_bits<float>::value == 32;
+                static constexpr int max_digits = 6;
+                static constexpr int max_decimal_shift = 10;
+            };
+
+            // P = 8 rather than what 2^-52 allows, so that c gets printed by print_9_digits with its
+            // trailing zeros removed.
+            template <>
+            struct short_decimal_traits<ieee754_binary_traits<ieee754_binary64, stdr::uint_least64_t>> {
+                using float_type = double;
+                static constexpr bool enabled = JKJ_HAS_STRICT_FLOAT_EVALUATION &&
+                                                stdr::numeric_limits<double>::is_iec559 &&
+                                                physical_bits<double>::value == 64;
+                static constexpr int max_digits = 8;
+                static constexpr int max_decimal_shift = 22;
+            };
+
+            template <class FormatTraits, bool enabled = short_decimal_traits<FormatTraits>::enabled>
+            struct short_decimal {
+                // Returns c and -d, or zero significand if the candidate is rejected.
+                static decimal_fp<typename FormatTraits::carrier_uint, int, false, false>
+                compute(signed_significand_bits<FormatTraits>,
+                        typename FormatTraits::exponent_int) noexcept {
+                    return {0, 0};
+                }
+            };
+
+            template <class FormatTraits>
+            struct short_decimal<FormatTraits, true> {
+                using traits = short_decimal_traits<FormatTraits>;
+                using float_type = typename traits::float_type;
+                using format = typename FormatTraits::format;
+                using carrier_uint = typename FormatTraits::carrier_uint;
+
+                static decimal_fp<carrier_uint, int, false, false>
+                compute(signed_significand_bits<FormatTraits> s,
+                        typename FormatTraits::exponent_int exponent_bits) noexcept {
+                    // Exact powers of 10.
+                    static constexpr float_type powers_of_10[] = {
+                        float_type(1e0),  float_type(1e1),  float_type(1e2),  float_type(1e3),
+                        float_type(1e4),  float_type(1e5),  float_type(1e6),  float_type(1e7),
+                        float_type(1e8),  float_type(1e9),  float_type(1e10), float_type(1e11),
+                        float_type(1e12), float_type(1e13), float_type(1e14), float_type(1e15),
+                        float_type(1e16), float_type(1e17), float_type(1e18), float_type(1e19),
+                        float_type(1e20), float_type(1e21), float_type(1e22)};
+                    static_assert(traits::max_decimal_shift <
+                                      int(sizeof(powers_of_10) / sizeof(powers_of_10[0])),
+                                  "");
+
+                    auto const decimal_shift =
+                        traits::max_digits - 1 -
+                        int(log::floor_log10_pow2(int(exponent_bits) + format::exponent_bias + 1));
+                    if (unsigned(decimal_shift) > unsigned(traits::max_decimal_shift)) {
+                        return {0, 0};
+                    }
+
+                    auto const x = bit_cast<float_type>(
+                        carrier_uint((carrier_uint(exponent_bits) << format::significand_bits) |
+                                     (s.remove_sign_bit_and_shift() >> 1)));
+                    auto const power = powers_of_10[decimal_shift];
+                    auto const c = carrier_uint(x * power + float_type(0.5));
+                    if (c < compute_power<traits::max_digits>(carrier_uint(10)) &&
+                        float_type(c) / power == x) {
+                        return {c, -decimal_shift};
+                    }
+                    return {0, 0};
+                }
+            };
+        }
+
         namespace policy {
             namespace digit_generation {
                 JKJ_INLINE_VARIABLE struct fast_t {
                     using digit_generation_policy = fast_t;
 
                     template <class DecimalToBinaryRoundingPolicy, class BinaryToDecimalRoundingPolicy,
-                              class CachePolicy, class PreferredIntegerTypesPolicy, class FormatTraits>
+                              class CachePolicy, class PreferredIntegerTypesPolicy,
+                              class BranchingPolicy, class IntegerFastPathPolicy, class FormatTraits>
                     static char* to_chars(signed_significand_bits<FormatTraits> s,
                                           typename FormatTraits::exponent_int exponent_bits,
                                           char* buffer) noexcept {
                         auto result = to_decimal_ex(
                             s, exponent_bits, policy::sign::ignore, policy::trailing_zero::ignore,
                             DecimalToBinaryRoundingPolicy{}, BinaryToDecimalRoundingPolicy{},
-                            CachePolicy{}, PreferredIntegerTypesPolicy{});
+                            CachePolicy{}, PreferredIntegerTypesPolicy{}, BranchingPolicy{},
+                            IntegerFastPathPolicy{});
 
                         return detail::to_chars<typename FormatTraits::format>(result.significand,
                                                                                result.exponent, buffer);
@@ -261,7 +388,8 @@ namespace JKJ_NAMESPACE {
                     using digit_generation_policy = compact_t;
 
                     template <class DecimalToBinaryRoundingPolicy, class BinaryToDecimalRoundingPolicy,
-                              class CachePolicy, class PreferredIntegerTypesPolicy, class FormatTraits>
+                              class CachePolicy, class PreferredIntegerTypesPolicy,
+                              class BranchingPolicy, class IntegerFastPathPolicy, class FormatTraits>
                     static JKJ_CONSTEXPR20 char*
                     to_chars(signed_significand_bits<FormatTraits> s,
                              typename FormatTraits::exponent_int exponent_bits, char* buffer) noexcept {
@@ -269,12 +397,49 @@ namespace JKJ_NAMESPACE {
                                                     policy::trailing_zero::remove_compact,
                                                     DecimalToBinaryRoundingPolicy{},
                                                     BinaryToDecimalRoundingPolicy{}, CachePolicy{},
-                                                    PreferredIntegerTypesPolicy{});
+                                                    PreferredIntegerTypesPolicy{}, BranchingPolicy{},
+                                                    IntegerFastPathPolicy{});
 
                         return detail::to_chars_naive<typename FormatTraits::format>(
                             result.significand, result.exponent, buffer);
                     }
                 } compact = {};
+
+                // Same as fast, but for the default decimal-to-binary rounding first tries whether
+                // the shortest representation fits in 8 significant digits (6 for binary32) with a
+                // few floating-point operations, which mostly succeeds for prices and other
+                // fixed-decimal quantities, and prints it without running the general algorithm.
+                // This requires the default floating-point rounding mode at runtime, and is the same
+                // as fast when the compiler does not evaluate floating-point operations strictly.
+                JKJ_INLINE_VARIABLE struct short_decimal_first_t {
+                    using digit_generation_policy = short_decimal_first_t;
+
+                    template <class DecimalToBinaryRoundingPolicy, class BinaryToDecimalRoundingPolicy,
+                              class CachePolicy, class PreferredIntegerTypesPolicy,
+                              class BranchingPolicy, class IntegerFastPathPolicy, class FormatTraits>
+                    static char* to_chars(signed_significand_bits<FormatTraits> s,
+                                          typename FormatTraits::exponent_int exponent_bits,
+                                          char* buffer) noexcept {
+                        namespace d2b = policy::decimal_to_binary_rounding;
+                        JKJ_IF_CONSTEXPR(
+                            detail::stdr::is_same<DecimalToBinaryRoundingPolicy,
+                                                  d2b::nearest_to_even_t>::value ||
+                            detail::stdr::is_same<DecimalToBinaryRoundingPolicy,
+                                                  d2b::nearest_to_even_static_boundary_t>::value) {
+                            auto const result =
+                                detail::short_decimal<FormatTraits>::compute(s, exponent_bits);
+                            if (result.significand != 0) {
+                                return detail::to_chars<typename FormatTraits::format>(
+                                    result.significand, result.exponent, buffer);
+                            }
+                        }
+
+                        return fast_t::to_chars<DecimalToBinaryRoundingPolicy,
+                                                BinaryToDecimalRoundingPolicy, CachePolicy,
+                                                PreferredIntegerTypesPolicy, BranchingPolicy,
+                                                IntegerFastPathPolicy>(s, exponent_bits, buffer);
+                    }
+                } short_decimal_first = {};
             }
         }
 
@@ -287,10 +452,52 @@ namespace JKJ_NAMESPACE {
                 }
             };
 
+            // Output for zeros, after the sign.
+            JKJ_COLD_PATH JKJ_CONSTEXPR20 char* to_chars_n_zero(char* buffer) noexcept {
+                buffer[0] = '0';
+                buffer[1] = 'E';
+                buffer[2] = '0';
+                return buffer + 3;
+            }
+
+            // Output for infinities and NaNs, including the sign.
+            template <class SignedSignificandBits>
+            JKJ_COLD_PATH JKJ_CONSTEXPR20 char* to_chars_n_non_finite(SignedSignificandBits s,
+                                                                      char* buffer) noexcept {
+                if (s.has_all_zero_significand_bits()) {
+                    if (s.is_negative()) {
+                        *buffer = '-';
+                        ++buffer;
+                    }
+                    // MSVC generates two mov's for the below, so we guard it inside
+                    // JKJ_IF_CONSTEVAL.
+                    JKJ_IF_CONSTEVAL {
+                        buffer[0] = 'I';
+                        buffer[1] = 'n';
+                        buffer[2] = 'f';
+                        buffer[3] = 'i';
+                        buffer[4] = 'n';
+                        buffer[5] = 'i';
+                        buffer[6] = 't';
+                        buffer[7] = 'y';
+                    }
+                    else {
+                        stdr::memcpy(buffer, "Infinity", 8);
+                    }
+                    return buffer + 8;
+                }
+                else {
+                    buffer[0] = 'N';
+                    buffer[1] = 'a';
+                    buffer[2] = 'N';
+                    return buffer + 3;
+                }
+            }
+
             // Avoid needless ABI overhead incurred by tag dispatch.
             template <class DecimalToBinaryRoundingPolicy, class BinaryToDecimalRoundingPolicy,
-                      class CachePolicy, class PreferredIntegerTypesPolicy, class DigitGenerationPolicy,
-                      class FormatTraits>
+                      class CachePolicy, class PreferredIntegerTypesPolicy, class BranchingPolicy,
+                      class IntegerFastPathPolicy, class DigitGenerationPolicy, class FormatTraits>
             JKJ_CONSTEXPR20 char* to_chars_n_impl(float_bits<FormatTraits> br, char* buffer) noexcept {
                 auto const exponent_bits = br.extract_exponent_bits();
                 auto const s = br.remove_exponent_bits();
@@ -304,85 +511,295 @@ namespace JKJ_NAMESPACE {
                         JKJ_IF_CONSTEVAL {
                             return policy::digit_generation::compact_t::to_chars<
                                 DecimalToBinaryRoundingPolicy, BinaryToDecimalRoundingPolicy,
-                                CachePolicy, PreferredIntegerTypesPolicy>(s, exponent_bits, buffer);
+                                CachePolicy, PreferredIntegerTypesPolicy, BranchingPolicy,
+                                IntegerFastPathPolicy>(s, exponent_bits, buffer);
                         }
 
                         return DigitGenerationPolicy::template to_chars<
                             DecimalToBinaryRoundingPolicy, BinaryToDecimalRoundingPolicy, CachePolicy,
-                            PreferredIntegerTypesPolicy>(s, exponent_bits, buffer);
+                            PreferredIntegerTypesPolicy, BranchingPolicy, IntegerFastPathPolicy>(
+                            s, exponent_bits, buffer);
                     }
                     else {
-                        buffer[0] = '0';
-                        buffer[1] = 'E';
-                        buffer[2] = '0';
-                        return buffer + 3;
+                        return to_chars_n_zero(buffer);
                     }
                 }
                 else {
-                    if (s.has_all_zero_significand_bits()) {
-                        if (s.is_negative()) {
-                            *buffer = '-';
-                            ++buffer;
-                        }
-                        // MSVC generates two mov's for the below, so we guard it inside
-                        // JKJ_IF_CONSTEVAL.
-                        JKJ_IF_CONSTEVAL {
-                            buffer[0] = 'I';
-                            buffer[1] = 'n';
-                            buffer[2] = 'f';
-                            buffer[3] = 'i';
-                            buffer[4] = 'n';
-                            buffer[5] = 'i';
-                            buffer[6] = 't';
-                            buffer[7] = 'y';
-                        }
-                        else {
-                            stdr::memcpy(buffer, "Infinity", 8);
-                        }
-                        return buffer + 8;
-                    }
-                    else {
-                        buffer[0] = 'N';
-                        buffer[1] = 'a';
-                        buffer[2] = 'N';
-                        return buffer + 3;
-                    }
+                    return to_chars_n_non_finite(s, buffer);
                 }
             }
         }
 
+    #if defined(JKJ_DRAGONBOX_TO_CHARS_ISA_DISPATCH) && !JKJ_DRAGONBOX_TO_CHARS_HEADER_ONLY
+        // When dragonbox_to_chars is built with runtime ISA dispatch (see the CMake option
+        // DRAGONBOX_TO_CHARS_ISA_DISPATCH), it contains several copies of to_chars_n with the default
+        // policies, each compiled for a different instruction set level, and to_chars_n forwards to
+        // the best one for the running CPU, selected when the library is loaded. The same forwarding
+        // is used when the library is built with profile-guided optimization (see the CMake option
+        // DRAGONBOX_TO_CHARS_PGO), so that compute_nearest is compiled with the profile.
+        namespace detail {
+            enum class isa_level { baseline, x86_64_v2, x86_64_v3, x86_64_v4 };
+
+            // The level whose copy is currently in use.
+            extern isa_level selected_isa_level() noexcept;
+
+            // Returns the copy compiled for the given level, or nullptr if there is no such copy or
+            // the running CPU does not support the level. Mainly for benchmarking.
+            template <class FloatFormat, class CarrierUInt>
+            extern char* (*get_isa_variant(isa_level level) noexcept)(CarrierUInt, char*);
+
+            template <class FloatFormat, class CarrierUInt>
+            extern char* to_chars_n_dispatched(CarrierUInt bit_pattern, char* buffer) noexcept;
+
+        #ifdef JKJ_DRAGONBOX_TO_CHARS_PGO_USE
+            // Returns the baseline copy compiled without the profile, to be compared with the one
+            // returned by get_isa_variant(isa_level::baseline). Mainly for benchmarking.
+            template <class FloatFormat, class CarrierUInt>
+            extern char* (*get_variant_without_profile() noexcept)(CarrierUInt, char*);
+        #endif
+
+            template <class FormatTraits, class PolicyHolder>
+            struct is_isa_dispatched {
+                static constexpr bool value =
+                    (stdr::is_same<FormatTraits, ieee754_binary_traits<ieee754_binary32,
+                                                                       stdr::uint_least32_t>>::value ||
+                     stdr::is_same<FormatTraits, ieee754_binary_traits<ieee754_binary64,
+                                                                       stdr::uint_least64_t>>::value) &&
+                    stdr::is_same<typename PolicyHolder::decimal_to_binary_rounding_policy,
+                                  policy::decimal_to_binary_rounding::nearest_to_even_t>::value &&
+                    stdr::is_same<typename PolicyHolder::binary_to_decimal_rounding_policy,
+                                  policy::binary_to_decimal_rounding::to_even_t>::value &&
+                    stdr::is_same<typename PolicyHolder::cache_policy, policy::cache::full_t>::value &&
+                    stdr::is_same<typename PolicyHolder::preferred_integer_types_policy,
+                                  policy::preferred_integer_types::match_t>::value &&
+                    stdr::is_same<typename PolicyHolder::branching_policy,
+                                  policy::branching::branchy_t>::value &&
+                    stdr::is_same<typename PolicyHolder::integer_fast_path_policy,
+                                  policy::integer_fast_path::disabled_t>::value &&
+                    stdr::is_same<typename PolicyHolder::digit_generation_policy,
+                                  policy::digit_generation::fast_t>::value;
+            };
+
+            template <bool dispatched>
+            struct to_chars_n_selector {
+                template <class PolicyHolder, class FormatTraits>
+                static JKJ_CONSTEXPR20 char* to_chars_n(float_bits<FormatTraits> br,
+                                                        char* buffer) noexcept {
+                    return to_chars_n_impl<typename PolicyHolder::decimal_to_binary_rounding_policy,
+                                           typename PolicyHolder::binary_to_decimal_rounding_policy,
+                                           typename PolicyHolder::cache_policy,
+                                           typename PolicyHolder::preferred_integer_types_policy,
+                                           typename PolicyHolder::branching_policy,
+                                           typename PolicyHolder::integer_fast_path_policy,
+                                           typename PolicyHolder::digit_generation_policy>(br,
+                                                                                           buffer);
+                }
+            };
+
+            template <>
+            struct to_chars_n_selector<true> {
+                template <class PolicyHolder, class FormatTraits>
+                static JKJ_CONSTEXPR20 char* to_chars_n(float_bits<FormatTraits> br,
+                                                        char* buffer) noexcept {
+                    JKJ_IF_CONSTEVAL {
+                        return to_chars_n_selector<false>::to_chars_n<PolicyHolder>(br, buffer);
+                    }
+                    return to_chars_n_dispatched<typename FormatTraits::format>(br.u, buffer);
+                }
+            };
+        }
+    #endif
+
+        namespace detail {
+            // Integer printing for the integer overloads of to_chars_n below. These use the same
+            // digit generation routine as the floating-point overloads.
+            JKJ_DRAGONBOX_TO_CHARS_INLINE char* to_chars_n_unsigned(stdr::uint_least32_t n,
+                                                                    char* buffer) noexcept;
+            JKJ_DRAGONBOX_TO_CHARS_INLINE char* to_chars_n_unsigned(stdr::uint_least64_t n,
+                                                                    char* buffer) noexcept;
+
+            template <class Int, class = void>
+            struct integer_to_chars_traits {
+                static constexpr bool is_supported = false;
+            };
+
+            template <class Int>
+            struct integer_to_chars_traits<
+                Int, typename stdr::enable_if<stdr::is_integral<Int>::value &&
+                                              !stdr::is_same<Int, bool>::value>::type> {
+                static constexpr bool is_supported = true;
+                static constexpr bool is_signed = stdr::is_signed<Int>::value;
+                using unsigned_type = typename stdr::make_unsigned<Int>::type;
+                using carrier_uint =
+                    typename stdr::conditional<sizeof(Int) <= 4, stdr::uint_least32_t,
+                                               stdr::uint_least64_t>::type;
+            };
+
+            // clang-format off
+#if defined(__SIZEOF_INT128__)
+            JKJ_DRAGONBOX_TO_CHARS_INLINE char* to_chars_n_unsigned(wuint::builtin_uint128_t n,
+                                                                    char* buffer) noexcept;
+
+#if defined(__GNUC__)
+            __extension__
+#endif
+            using builtin_int128_t = __int128;
+
+            // Depending on the language mode, the standard library may or may not regard these as
+            // integral types.
+            template <>
+            struct integer_to_chars_traits<wuint::builtin_uint128_t> {
+                static constexpr bool is_supported = true;
+                static constexpr bool is_signed = false;
+                using unsigned_type = wuint::builtin_uint128_t;
+                using carrier_uint = wuint::builtin_uint128_t;
+            };
+            template <>
+            struct integer_to_chars_traits<builtin_int128_t> {
+                static constexpr bool is_supported = true;
+                static constexpr bool is_signed = true;
+                using unsigned_type = wuint::builtin_uint128_t;
+                using carrier_uint = wuint::builtin_uint128_t;
+            };
+#endif
+            // clang-format on
+
+            template <bool is_signed>
+            struct integer_sign_handler {
+                template <class Int>
+                static constexpr bool is_negative(Int) noexcept {
+                    return false;
+                }
+            };
+            template <>
+            struct integer_sign_handler<true> {
+                template <class Int>
+                static constexpr bool is_negative(Int x) noexcept {
+                    return x < 0;
+                }
+            };
+
+            template <class T>
+            struct is_decimal_fp {
+                static constexpr bool value = false;
+            };
+            template <class SignificandType, class ExponentType, bool is_signed,
+                      bool trailing_zero_flag>
+            struct is_decimal_fp<
+                decimal_fp<SignificandType, ExponentType, is_signed, trailing_zero_flag>> {
+                static constexpr bool value = true;
+            };
+
+            // The format whose digit printer the decimal_fp overloads of to_chars_n/to_chars use,
+            // determined by the width of the significand type rather than by the type itself, so
+            // that e.g. unsigned long long works as well where it is not uint_least64_t.
+            template <class SignificandType,
+                      int digits = stdr::numeric_limits<SignificandType>::digits>
+            struct decimal_fp_format;
+            template <class SignificandType>
+            struct decimal_fp_format<SignificandType, 32> {
+                using type = ieee754_binary32;
+                using carrier_uint = stdr::uint_least32_t;
+            };
+            template <class SignificandType>
+            struct decimal_fp_format<SignificandType, 64> {
+                using type = ieee754_binary64;
+                using carrier_uint = stdr::uint_least64_t;
+            };
+
+            template <bool is_signed>
+            struct decimal_fp_sign_handler {
+                template <class DecimalFp>
+                static constexpr bool is_negative(DecimalFp const&) noexcept {
+                    return false;
+                }
+            };
+            template <>
+            struct decimal_fp_sign_handler<true> {
+                template <class DecimalFp>
+                static constexpr bool is_negative(DecimalFp const& v) noexcept {
+                    return v.is_negative;
+                }
+            };
+
+            template <bool trailing_zero_flag>
+            struct decimal_fp_trailing_zero_handler {
+                template <class DecimalFp>
+                static constexpr bool may_have_trailing_zeros(DecimalFp const&) noexcept {
+                    return false;
+                }
+            };
+            template <>
+            struct decimal_fp_trailing_zero_handler<true> {
+                template <class DecimalFp>
+                static constexpr bool may_have_trailing_zeros(DecimalFp const& v) noexcept {
+                    return v.may_have_trailing_zeros;
+                }
+            };
+
+            // The default ConversionTraits of the floating-point overloads of to_chars_n/to_chars.
+            // For integer types and decimal_fp this has no format member, so that those overloads
+            // drop out of the overload resolution in favor of the integer and decimal_fp overloads,
+            // rather than hitting the static_assert inside default_float_bit_carrier_conversion_traits.
+            template <class T, bool = integer_to_chars_traits<T>::is_supported ||
+                                      is_decimal_fp<T>::value>
+            struct default_to_chars_conversion_traits {
+                using type = default_float_bit_carrier_conversion_traits<T>;
+            };
+            template <class T>
+            struct default_to_chars_conversion_traits<T, true> {
+                struct type {};
+            };
+
+            template <class... Policies>
+            using to_chars_policy_holder = make_policy_holder<
+                detector_default_pair_list<
+                    detector_default_pair<is_decimal_to_binary_rounding_policy,
+                                          policy::decimal_to_binary_rounding::nearest_to_even_t>,
+                    detector_default_pair<is_binary_to_decimal_rounding_policy,
+                                          policy::binary_to_decimal_rounding::to_even_t>,
+                    detector_default_pair<is_cache_policy, policy::cache::full_t>,
+                    detector_default_pair<is_preferred_integer_types_policy,
+                                          policy::preferred_integer_types::match_t>,
+                    detector_default_pair<is_branching_policy, policy::branching::branchy_t>,
+                    detector_default_pair<is_integer_fast_path_policy,
+                                          policy::integer_fast_path::disabled_t>,
+                    detector_default_pair<is_digit_generation_policy,
+                                          policy::digit_generation::fast_t>>,
+                Policies...>;
+        }
+
         // Returns the next-to-end position
         template <class Float,
-                  class ConversionTraits = default_float_bit_carrier_conversion_traits<Float>,
+                  class ConversionTraits =
+                      typename detail::default_to_chars_conversion_traits<Float>::type,
                   class FormatTraits = ieee754_binary_traits<typename ConversionTraits::format,
                                                              typename ConversionTraits::carrier_uint>,
                   class... Policies>
         JKJ_CONSTEXPR20 char* to_chars_n(Float x, char* buffer, Policies...) noexcept {
-            using policy_holder = detail::make_policy_holder<
-                detail::detector_default_pair_list<
-                    detail::detector_default_pair<
-                        detail::is_decimal_to_binary_rounding_policy,
-                        policy::decimal_to_binary_rounding::nearest_to_even_t>,
-                    detail::detector_default_pair<detail::is_binary_to_decimal_rounding_policy,
-                                                  policy::binary_to_decimal_rounding::to_even_t>,
-                    detail::detector_default_pair<detail::is_cache_policy, policy::cache::full_t>,
-                    detail::detector_default_pair<detail::is_preferred_integer_types_policy,
-                                                  policy::preferred_integer_types::match_t>,
-                    detail::detector_default_pair<detail::is_digit_generation_policy,
-                                                  policy::digit_generation::fast_t>>,
-                Policies...>;
+            using policy_holder = detail::to_chars_policy_holder<Policies...>;
 
+    #if defined(JKJ_DRAGONBOX_TO_CHARS_ISA_DISPATCH) && !JKJ_DRAGONBOX_TO_CHARS_HEADER_ONLY
+            return detail::to_chars_n_selector<
+                detail::is_isa_dispatched<FormatTraits, policy_holder>::value>::
+                template to_chars_n<policy_holder>(
+                    make_float_bits<Float, ConversionTraits, FormatTraits>(x), buffer);
+    #else
             return detail::to_chars_n_impl<typename policy_holder::decimal_to_binary_rounding_policy,
                                            typename policy_holder::binary_to_decimal_rounding_policy,
                                            typename policy_holder::cache_policy,
                                            typename policy_holder::preferred_integer_types_policy,
+                                           typename policy_holder::branching_policy,
+                                           typename policy_holder::integer_fast_path_policy,
                                            typename policy_holder::digit_generation_policy>(
                 make_float_bits<Float, ConversionTraits, FormatTraits>(x), buffer);
+    #endif
         }
 
         // Null-terminate and bypass the return value of to_chars_n
         template <class Float,
-                  class ConversionTraits = default_float_bit_carrier_conversion_traits<Float>,
+                  class ConversionTraits =
+                      typename detail::default_to_chars_conversion_traits<Float>::type,
                   class FormatTraits = ieee754_binary_traits<typename ConversionTraits::format,
                                                              typename ConversionTraits::carrier_uint>,
                   class... Policies>
@@ -392,6 +809,377 @@ namespace JKJ_NAMESPACE {
             return ptr;
         }
 
+        // Prints a decimal_fp, such as the result of to_decimal with any policies or a decimal
+        // obtained elsewhere, in the same form as to_chars_n, and returns the next-to-end position.
+        // A std::uint_least32_t significand is printed like binary32 and a std::uint_least64_t one
+        // like binary64: it should be nonzero and of at most 9 and 17 digits respectively, and the
+        // exponent of its leading digit should have at most 2 and 3 digits. Trailing zeros are
+        // removed first if may_have_trailing_zeros is true; otherwise a significand of 9 or 17
+        // digits should not have any.
+        template <class SignificandType, class ExponentType, bool is_signed, bool trailing_zero_flag>
+        char* to_chars_n(decimal_fp<SignificandType, ExponentType, is_signed, trailing_zero_flag> v,
+                         char* buffer) noexcept {
+            using format = typename detail::decimal_fp_format<SignificandType>::type;
+            using carrier_uint = typename detail::decimal_fp_format<SignificandType>::carrier_uint;
+
+            if (detail::decimal_fp_sign_handler<is_signed>::is_negative(v)) {
+                *buffer = '-';
+                ++buffer;
+            }
+            if (detail::decimal_fp_trailing_zero_handler<trailing_zero_flag>::may_have_trailing_zeros(
+                    v)) {
+                auto const r = policy::trailing_zero::remove_t::on_trailing_zeros<format>(
+                    carrier_uint(v.significand), int(v.exponent));
+                return detail::to_chars<format>(r.significand, r.exponent, buffer);
+            }
+            return detail::to_chars<format>(carrier_uint(v.significand), int(v.exponent), buffer);
+        }
+
+        // Null-terminate and bypass the return value of to_chars_n
+        template <class SignificandType, class ExponentType, bool is_signed, bool trailing_zero_flag>
+        char* to_chars(decimal_fp<SignificandType, ExponentType, is_signed, trailing_zero_flag> v,
+                       char* buffer) noexcept {
+            auto ptr = to_chars_n(v, buffer);
+            *ptr = '\0';
+            return ptr;
+        }
+
+        namespace detail {
+            // 10^k for k = 0, ... , 19.
+            JKJ_INLINE_VARIABLE stdr::uint_least64_t power_of_10_table[20] JKJ_STATIC_DATA_SECTION = {
+                UINT64_C(1),
+                UINT64_C(10),
+                UINT64_C(100),
+                UINT64_C(1000),
+                UINT64_C(10000),
+                UINT64_C(100000),
+                UINT64_C(1000000),
+                UINT64_C(10000000),
+                UINT64_C(100000000),
+                UINT64_C(1000000000),
+                UINT64_C(10000000000),
+                UINT64_C(100000000000),
+                UINT64_C(1000000000000),
+                UINT64_C(10000000000000),
+                UINT64_C(100000000000000),
+                UINT64_C(1000000000000000),
+                UINT64_C(10000000000000000),
+                UINT64_C(100000000000000000),
+                UINT64_C(1000000000000000000),
+                UINT64_C(10000000000000000000)};
+
+            // floor(log2(n)) + 1 for nonzero n.
+            inline JKJ_CONSTEXPR20 int bit_width(stdr::uint_least64_t n) noexcept {
+    #if JKJ_HAS_BUILTIN(__builtin_clzll)
+                return value_bits<unsigned long long>::value - __builtin_clzll(n);
+    #else
+        #if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_ARM64))
+                JKJ_IF_NOT_CONSTEVAL {
+                    unsigned long index;
+                    _BitScanReverse64(&index, n);
+                    return int(index) + 1;
+                }
+        #endif
+                int width = 0;
+                for (; n != 0; n >>= 1) {
+                    ++width;
+                }
+                return width;
+    #endif
+            }
+
+            // Number of decimal digits of nonzero n. If n has w bits, the number of digits minus one
+            // is between floor(log10(2^(w-1))) and floor(log10(2^w)) =: t, which differ by at most
+            // one, so the number of digits is t + 1 if n >= 10^t and t otherwise.
+            inline JKJ_CONSTEXPR20 int decimal_digit_count(stdr::uint_least64_t n) noexcept {
+                auto const t = int(log::floor_log10_pow2<0, 64>(bit_width(n)));
+                return t + int(n >= read_static_data(power_of_10_table + t));
+            }
+
+            // Number of characters to_chars prints for significand * 10^exponent, where significand
+            // is nonzero and has no trailing zeros.
+            inline JKJ_CONSTEXPR20 stdr::size_t to_chars_length(stdr::uint_least64_t significand,
+                                                                int exponent) noexcept {
+                auto const digits = decimal_digit_count(significand);
+                auto const printed_exponent = exponent + digits - 1;
+                auto const abs_exponent =
+                    printed_exponent < 0 ? -printed_exponent : printed_exponent;
+                // digits + decimal point + 'E' + exponent sign + exponent digits
+                return stdr::size_t(digits + int(digits > 1) + 1 + int(printed_exponent < 0) + 1 +
+                                    int(abs_exponent >= 10) + int(abs_exponent >= 100));
+            }
+
+            template <class FormatTraits, class PolicyHolder>
+            struct formatted_length_impl {
+                using decimal_to_binary_rounding_policy =
+                    typename PolicyHolder::decimal_to_binary_rounding_policy;
+                using binary_to_decimal_rounding_policy =
+                    typename PolicyHolder::binary_to_decimal_rounding_policy;
+                using cache_policy = typename PolicyHolder::cache_policy;
+                using preferred_integer_types_policy =
+                    typename PolicyHolder::preferred_integer_types_policy;
+                using branching_policy = typename PolicyHolder::branching_policy;
+                using integer_fast_path_policy = typename PolicyHolder::integer_fast_path_policy;
+
+                static JKJ_CONSTEXPR20 stdr::size_t compute(float_bits<FormatTraits> br) noexcept {
+                    auto const exponent_bits = br.extract_exponent_bits();
+                    auto const s = br.remove_exponent_bits();
+                    auto const sign_length = stdr::size_t(s.is_negative());
+
+                    if (br.is_finite(exponent_bits)) {
+                        if (br.is_nonzero()) {
+                            auto const result = to_decimal_ex(
+                                s, exponent_bits, policy::sign::ignore, policy::trailing_zero::remove,
+                                decimal_to_binary_rounding_policy{},
+                                binary_to_decimal_rounding_policy{}, cache_policy{},
+                                preferred_integer_types_policy{}, branching_policy{},
+                                integer_fast_path_policy{});
+                            return sign_length +
+                                   to_chars_length(result.significand, int(result.exponent));
+                        }
+                        // "0E0"
+                        return sign_length + 3;
+                    }
+                    // "Infinity" or "NaN"
+                    return s.has_all_zero_significand_bits() ? sign_length + 8 : 3;
+                }
+
+                // Blocks of finite nonzero inputs go through to_decimal_batch, so that runs of
+                // inputs with the same exponent bits share the cache lookup.
+                template <class Float, class ConversionTraits>
+                static JKJ_CONSTEXPR20 stdr::size_t compute_batch(Float const* first, Float const* last,
+                                                                  stdr::size_t* lengths) noexcept {
+                    constexpr stdr::size_t block_size = 64;
+                    to_decimal_return_type<FormatTraits, policy::sign::return_sign_t,
+                                           policy::trailing_zero::remove_t,
+                                           preferred_integer_types_policy>
+                        decimals[block_size];
+
+                    stdr::size_t total_length = 0;
+                    while (first != last) {
+                        auto const block_last =
+                            stdr::size_t(last - first) < block_size ? last : first + block_size;
+                        auto const count = stdr::size_t(block_last - first);
+
+                        bool all_finite_nonzero = true;
+                        for (stdr::size_t idx = 0; idx < count; ++idx) {
+                            auto const br =
+                                make_float_bits<Float, ConversionTraits, FormatTraits>(first[idx]);
+                            all_finite_nonzero &= br.is_finite() && br.is_nonzero();
+                        }
+
+                        if (all_finite_nonzero) {
+                            to_decimal_batch<Float, ConversionTraits, FormatTraits>(
+                                first, block_last, decimals, policy::sign::return_sign,
+                                policy::trailing_zero::remove, decimal_to_binary_rounding_policy{},
+                                binary_to_decimal_rounding_policy{}, cache_policy{},
+                                preferred_integer_types_policy{}, branching_policy{},
+                                integer_fast_path_policy{});
+                            for (stdr::size_t idx = 0; idx < count; ++idx) {
+                                lengths[idx] =
+                                    stdr::size_t(decimals[idx].is_negative) +
+                                    to_chars_length(decimals[idx].significand,
+                                                    int(decimals[idx].exponent));
+                                total_length += lengths[idx];
+                            }
+                        }
+                        else {
+                            for (stdr::size_t idx = 0; idx < count; ++idx) {
+                                lengths[idx] = compute(
+                                    make_float_bits<Float, ConversionTraits, FormatTraits>(first[idx]));
+                                total_length += lengths[idx];
+                            }
+                        }
+
+                        first = block_last;
+                        lengths += count;
+                    }
+                    return total_length;
+                }
+            };
+        }
+
+        // The number of characters to_chars_n(x, buffer, policies...) writes, without writing them.
+        template <class Float,
+                  class ConversionTraits =
+                      typename detail::default_to_chars_conversion_traits<Float>::type,
+                  class FormatTraits = ieee754_binary_traits<typename ConversionTraits::format,
+                                                             typename ConversionTraits::carrier_uint>,
+                  class... Policies>
+        JKJ_CONSTEXPR20 detail::stdr::size_t formatted_length(Float x, Policies...) noexcept {
+            return detail::formatted_length_impl<FormatTraits,
+                                                 detail::to_chars_policy_holder<Policies...>>::
+                compute(make_float_bits<Float, ConversionTraits, FormatTraits>(x));
+        }
+
+        // Stores formatted_length(x, policies...) into lengths for each x in [first, last), in
+        // order, and returns their sum.
+        template <class Float,
+                  class ConversionTraits =
+                      typename detail::default_to_chars_conversion_traits<Float>::type,
+                  class FormatTraits = ieee754_binary_traits<typename ConversionTraits::format,
+                                                             typename ConversionTraits::carrier_uint>,
+                  class... Policies>
+        JKJ_CONSTEXPR20 detail::stdr::size_t formatted_length_batch(Float const* first,
+                                                                    Float const* last,
+                                                                    detail::stdr::size_t* lengths,
+                                                                    Policies...) noexcept {
+            return detail::formatted_length_impl<FormatTraits,
+                                                 detail::to_chars_policy_holder<Policies...>>::
+                template compute_batch<Float, ConversionTraits>(first, last, lengths);
+        }
+
+        // Integer overloads. Print the decimal representation of x without leading zeros and
+        // return the next-to-end position. At most std::numeric_limits<Int>::digits10 + 2
+        // characters, including the minus sign, are written.
+        template <class Int, typename detail::stdr::enable_if<
+                                 detail::integer_to_chars_traits<Int>::is_supported, bool>::type = true>
+        char* to_chars_n(Int x, char* buffer) noexcept {
+            using traits = detail::integer_to_chars_traits<Int>;
+            using unsigned_type = typename traits::unsigned_type;
+
+            auto n = static_cast<unsigned_type>(x);
+            if (detail::integer_sign_handler<traits::is_signed>::is_negative(x)) {
+                *buffer = '-';
+                ++buffer;
+                n = static_cast<unsigned_type>(unsigned_type(0) - n);
+            }
+            return detail::to_chars_n_unsigned(static_cast<typename traits::carrier_uint>(n),
+                                               buffer);
+        }
+
+        // Null-terminate and bypass the return value of to_chars_n
+        template <class Int, typename detail::stdr::enable_if<
+                                 detail::integer_to_chars_traits<Int>::is_supported, bool>::type = true>
+        char* to_chars(Int x, char* buffer) noexcept {
+            auto ptr = to_chars_n(x, buffer);
+            *ptr = '\0';
+            return ptr;
+        }
+
+        // Entry points taking the rounding modes as runtime values rather than as policy types.
+        // They are compiled once into dragonbox_to_chars, which maps every combination of the modes
+        // onto a fixed set of precompiled kernels (binary-to-decimal rounding only matters for the
+        // nearest rounding modes, so the directed ones share a single kernel each), so that
+        // selecting the rounding modes from configuration does not require instantiating every
+        // combination of the policies. The cache and the integer types are always the defaults.
+        // Not available if JKJ_DRAGONBOX_TO_CHARS_HEADER_ONLY is defined to be 1.
+        namespace runtime {
+            // Each enumerator corresponds to the policy of the same name in
+            // policy::decimal_to_binary_rounding.
+            enum class decimal_to_binary_rounding {
+                nearest_to_even,
+                nearest_to_odd,
+                nearest_toward_plus_infinity,
+                nearest_toward_minus_infinity,
+                nearest_toward_zero,
+                nearest_away_from_zero,
+                toward_plus_infinity,
+                toward_minus_infinity,
+                toward_zero,
+                away_from_zero
+            };
+
+            using binary_to_decimal_rounding = policy::binary_to_decimal_rounding::tag_t;
+
+            struct policies {
+                decimal_to_binary_rounding decimal_to_binary;
+                binary_to_decimal_rounding binary_to_decimal;
+
+                constexpr policies(
+                    decimal_to_binary_rounding decimal_to_binary_ =
+                        decimal_to_binary_rounding::nearest_to_even,
+                    binary_to_decimal_rounding binary_to_decimal_ =
+                        binary_to_decimal_rounding::to_even) noexcept
+                    : decimal_to_binary{decimal_to_binary_}, binary_to_decimal{binary_to_decimal_} {}
+            };
+
+            // Same as the default to_decimal except for the rounding modes. The input should be
+            // finite and nonzero.
+            extern signed_decimal_fp<detail::stdr::uint_least32_t, int>
+            to_decimal(float x, policies p = {}) noexcept;
+            extern signed_decimal_fp<detail::stdr::uint_least64_t, int>
+            to_decimal(double x, policies p = {}) noexcept;
+
+            // Returns the next-to-end position
+            extern char* to_chars_n(float x, char* buffer, policies p = {}) noexcept;
+            extern char* to_chars_n(double x, char* buffer, policies p = {}) noexcept;
+
+            // Null-terminate and bypass the return value of to_chars_n
+            inline char* to_chars(float x, char* buffer, policies p = {}) noexcept {
+                auto ptr = to_chars_n(x, buffer, p);
+                *ptr = '\0';
+                return ptr;
+            }
+            inline char* to_chars(double x, char* buffer, policies p = {}) noexcept {
+                auto ptr = to_chars_n(x, buffer, p);
+                *ptr = '\0';
+                return ptr;
+            }
+        }
+
+        // Same as to_chars_n with the default policies, but remembers the outputs for recently seen
+        // inputs in a small direct-mapped cache local to the calling thread, keyed on the bit
+        // pattern, so that formatting the same value again only copies the remembered output. This
+        // pays off only if the same few values are formatted over and over; the statistics below
+        // tell how often that happens. Unlike to_chars_n, the whole max_output_string_length bytes of
+        // the buffer may be overwritten. Compiled into dragonbox_to_chars, so not available if
+        // JKJ_DRAGONBOX_TO_CHARS_HEADER_ONLY is defined to be 1.
+        extern char* memoizing_to_chars_n(float x, char* buffer) noexcept;
+        extern char* memoizing_to_chars_n(double x, char* buffer) noexcept;
+
+        // Null-terminate and bypass the return value of memoizing_to_chars_n
+        inline char* memoizing_to_chars(float x, char* buffer) noexcept {
+            auto ptr = memoizing_to_chars_n(x, buffer);
+            *ptr = '\0';
+            return ptr;
+        }
+        inline char* memoizing_to_chars(double x, char* buffer) noexcept {
+            auto ptr = memoizing_to_chars_n(x, buffer);
+            *ptr = '\0';
+            return ptr;
+        }
+
+        // The numbers of calls to memoizing_to_chars_n/memoizing_to_chars on the calling thread
+        // that found or did not find the input in the cache, since the thread started or since the
+        // last call to reset_memoizing_statistics on it.
+        struct memoizing_statistics {
+            detail::stdr::uint_least64_t hits;
+            detail::stdr::uint_least64_t misses;
+        };
+
+        extern memoizing_statistics get_memoizing_statistics() noexcept;
+        extern void reset_memoizing_statistics() noexcept;
+
+        // Writes to_chars_n(x) followed by the delimiter for each x in [first, last) into buffer, in
+        // order, using thread_count threads including the calling one (or as many as the hardware
+        // supports if zero), and returns the end of the output. The first pass computes to_decimal
+        // and the output length for each input, and the second pass prints the digits at the exact
+        // offsets into buffer. The decimal results for all inputs are held in between, so this
+        // allocates about twice the size of the input. The buffer should have room for
+        // (max_output_string_length + 1) characters per input. Compiled into dragonbox_parallel
+        // (which also links dragonbox_to_chars and the thread library), so not available if
+        // JKJ_DRAGONBOX_TO_CHARS_HEADER_ONLY is defined to be 1. May throw std::bad_alloc or
+        // std::system_error.
+        extern char* parallel_to_chars_n(float const* first, float const* last, char* buffer,
+                                         char delimiter, unsigned int thread_count = 0);
+        extern char* parallel_to_chars_n(double const* first, double const* last, char* buffer,
+                                         char delimiter, unsigned int thread_count = 0);
+
+        // Null-terminate and bypass the return value of parallel_to_chars_n
+        inline char* parallel_to_chars(float const* first, float const* last, char* buffer,
+                                       char delimiter, unsigned int thread_count = 0) {
+            auto ptr = parallel_to_chars_n(first, last, buffer, delimiter, thread_count);
+            *ptr = '\0';
+            return ptr;
+        }
+        inline char* parallel_to_chars(double const* first, double const* last, char* buffer,
+                                       char delimiter, unsigned int thread_count = 0) {
+            auto ptr = parallel_to_chars_n(first, last, buffer, delimiter, thread_count);
+            *ptr = '\0';
+            return ptr;
+        }
+
         // Maximum size of the output of to_chars_n (excluding null-terminator).
         template <class FloatFormat>
         struct max_output_string_length_holder {
@@ -408,7 +1196,19 @@ namespace JKJ_NAMESPACE {
     }
 }
 
+#if JKJ_DRAGONBOX_TO_CHARS_HEADER_ONLY
+    #include "dragonbox_to_chars_impl.h"
+#endif
+
 #ifndef JKJ_DRAGONBOX_TO_CHARS_LEAK_MACROS
+    #undef JKJ_HAS_STRICT_FLOAT_EVALUATION
+    #undef JKJ_DRAGONBOX_TO_CHARS_INLINE
+    #if JKJ_DRAGONBOX_TO_CHARS_HEADER_ONLY_DEFINED
+        #undef JKJ_DRAGONBOX_TO_CHARS_HEADER_ONLY_DEFINED
+    #else
+        #undef JKJ_DRAGONBOX_TO_CHARS_HEADER_ONLY
+    #endif
+
     // This will clean up all leaked macros.
     #undef JKJ_DRAGONBOX_LEAK_MACROS
     #include "dragonbox.h"
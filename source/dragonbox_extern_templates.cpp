@@ -0,0 +1,65 @@
+// Copyright 2025 Junekey Jeon
+//
+// The contents of this file may be used under the terms of
+// the Apache License v2.0 with LLVM Exceptions.
+//
+//    (See accompanying file LICENSE-Apache or copy at
+//     https://llvm.org/foundation/relicensing/LICENSE.txt)
+//
+// Alternatively, the contents of this file may be used under the terms of
+// the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE-Boost or copy at
+//     https://www.boost.org/LICENSE_1_0.txt)
+//
+// Unless required by applicable law or agreed to in writing, this software
+// is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.
+
+// Explicit instantiation definitions matching the extern template declarations enabled by
+// JKJ_DRAGONBOX_EXTERN_TEMPLATES in dragonbox.h.
+
+#define JKJ_DRAGONBOX_LEAK_MACROS
+#include "dragonbox/dragonbox.h"
+
+namespace JKJ_NAMESPACE {
+    namespace dragonbox {
+        namespace detail {
+            using instantiated_binary32_traits =
+                ieee754_binary_traits<ieee754_binary32, stdr::uint_least32_t>;
+            using instantiated_binary64_traits =
+                ieee754_binary_traits<ieee754_binary64, stdr::uint_least64_t>;
+
+            template to_decimal_return_type<instantiated_binary32_traits>
+            impl<instantiated_binary32_traits>::compute_nearest<
+                policy::sign::return_sign_t, policy::trailing_zero::remove_t,
+                policy::decimal_to_binary_rounding::nearest_to_even_t,
+                policy::binary_to_decimal_rounding::to_even_t, policy::cache::full_t,
+                policy::preferred_integer_types::match_t, policy::branching::branchy_t>(
+                signed_significand_bits<instantiated_binary32_traits>, int) noexcept;
+            template to_decimal_return_type<instantiated_binary32_traits, policy::sign::ignore_t,
+                                            policy::trailing_zero::ignore_t>
+            impl<instantiated_binary32_traits>::compute_nearest<
+                policy::sign::ignore_t, policy::trailing_zero::ignore_t,
+                policy::decimal_to_binary_rounding::nearest_to_even_t,
+                policy::binary_to_decimal_rounding::to_even_t, policy::cache::full_t,
+                policy::preferred_integer_types::match_t, policy::branching::branchy_t>(
+                signed_significand_bits<instantiated_binary32_traits>, int) noexcept;
+
+            template to_decimal_return_type<instantiated_binary64_traits>
+            impl<instantiated_binary64_traits>::compute_nearest<
+                policy::sign::return_sign_t, policy::trailing_zero::remove_t,
+                policy::decimal_to_binary_rounding::nearest_to_even_t,
+                policy::binary_to_decimal_rounding::to_even_t, policy::cache::full_t,
+                policy::preferred_integer_types::match_t, policy::branching::branchy_t>(
+                signed_significand_bits<instantiated_binary64_traits>, int) noexcept;
+            template to_decimal_return_type<instantiated_binary64_traits, policy::sign::ignore_t,
+                                            policy::trailing_zero::ignore_t>
+            impl<instantiated_binary64_traits>::compute_nearest<
+                policy::sign::ignore_t, policy::trailing_zero::ignore_t,
+                policy::decimal_to_binary_rounding::nearest_to_even_t,
+                policy::binary_to_decimal_rounding::to_even_t, policy::cache::full_t,
+                policy::preferred_integer_types::match_t, policy::branching::branchy_t>(
+                signed_significand_bits<instantiated_binary64_traits>, int) noexcept;
+        }
+    }
+}
@@ -0,0 +1,95 @@
+// Copyright 2025 Junekey Jeon
+//
+// The contents of this file may be used under the terms of
+// the Apache License v2.0 with LLVM Exceptions.
+//
+//    (See accompanying file LICENSE-Apache or copy at
+//     https://llvm.org/foundation/relicensing/LICENSE.txt)
+//
+// Alternatively, the contents of this file may be used under the terms of
+// the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE-Boost or copy at
+//     https://www.boost.org/LICENSE_1_0.txt)
+//
+// Unless required by applicable law or agreed to in writing, this software
+// is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.
+
+#define JKJ_DRAGONBOX_TO_CHARS_LEAK_MACROS
+#include "dragonbox/dragonbox_to_chars.h"
+
+namespace JKJ_NAMESPACE {
+    namespace dragonbox {
+        namespace detail {
+            namespace memoizing_impl {
+                // 256 entries, which take 10 KB per thread for binary64 and 5 KB for binary32.
+                static constexpr int cache_size_log2 = 8;
+
+                template <class FloatFormat, class CarrierUInt>
+                struct cache_entry {
+                    CarrierUInt bit_pattern;
+                    // Zero for an empty entry, since the output is never empty.
+                    unsigned char length;
+                    char chars[max_output_string_length_holder<FloatFormat>::value];
+                };
+
+                template <class FloatFormat, class CarrierUInt>
+                struct cache {
+                    cache_entry<FloatFormat, CarrierUInt> entries[stdr::size_t(1) << cache_size_log2];
+                };
+
+                static thread_local cache<ieee754_binary32, stdr::uint_least32_t> binary32_cache;
+                static thread_local cache<ieee754_binary64, stdr::uint_least64_t> binary64_cache;
+                static thread_local memoizing_statistics statistics;
+
+                template <class Float, class FloatFormat, class CarrierUInt>
+                static char* to_chars_n(Float x, char* buffer,
+                                        cache<FloatFormat, CarrierUInt>& c) noexcept {
+                    auto const bit_pattern = make_float_bits<Float>(x).u;
+                    // Fibonacci hashing, so that inputs differing only in a few bits of the
+                    // significand or of the exponent are spread over the whole table.
+                    auto& entry = c.entries[stdr::size_t(
+                        (stdr::uint_least64_t(bit_pattern) * UINT64_C(0x9e3779b97f4a7c15)) >>
+                        (64 - cache_size_log2))];
+
+                    // The copies below are of the fixed size of the longest output, which the
+                    // buffer is large enough for anyway, so that they are compiled into a few
+                    // moves rather than a call to memcpy or a rep movs.
+                    if (entry.bit_pattern == bit_pattern && entry.length != 0) {
+                        ++statistics.hits;
+                        stdr::memcpy(buffer, entry.chars, sizeof(entry.chars));
+                        return buffer + entry.length;
+                    }
+
+                    // Formatted into a local buffer rather than the caller's, since the bytes of
+                    // the latter past the output are indeterminate.
+                    ++statistics.misses;
+                    char chars[sizeof(entry.chars)];
+                    auto const length = static_cast<unsigned char>(
+                        JKJ_NAMESPACE::dragonbox::to_chars_n(x, chars) - chars);
+                    entry.bit_pattern = bit_pattern;
+                    entry.length = length;
+                    stdr::memcpy(entry.chars, chars, sizeof(entry.chars));
+                    stdr::memcpy(buffer, chars, sizeof(entry.chars));
+                    return buffer + length;
+                }
+            }
+        }
+
+        char* memoizing_to_chars_n(float x, char* buffer) noexcept {
+            return detail::memoizing_impl::to_chars_n(x, buffer,
+                                                      detail::memoizing_impl::binary32_cache);
+        }
+
+        char* memoizing_to_chars_n(double x, char* buffer) noexcept {
+            return detail::memoizing_impl::to_chars_n(x, buffer,
+                                                      detail::memoizing_impl::binary64_cache);
+        }
+
+        memoizing_statistics get_memoizing_statistics() noexcept {
+            return detail::memoizing_impl::statistics;
+        }
+
+        void reset_memoizing_statistics() noexcept { detail::memoizing_impl::statistics = {}; }
+    }
+}
@@ -0,0 +1,168 @@
+// Copyright 2025 Junekey Jeon
+//
+// The contents of this file may be used under the terms of
+// the Apache License v2.0 with LLVM Exceptions.
+//
+//    (See accompanying file LICENSE-Apache or copy at
+//     https://llvm.org/foundation/relicensing/LICENSE.txt)
+//
+// Alternatively, the contents of this file may be used under the terms of
+// the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE-Boost or copy at
+//     https://www.boost.org/LICENSE_1_0.txt)
+//
+// Unless required by applicable law or agreed to in writing, this software
+// is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.
+
+#define JKJ_DRAGONBOX_TO_CHARS_LEAK_MACROS
+#include "dragonbox/dragonbox_to_chars.h"
+
+#include <atomic>
+#include <memory>
+#include <thread>
+#include <vector>
+
+namespace JKJ_NAMESPACE {
+    namespace dragonbox {
+        namespace detail {
+            namespace parallel_impl {
+                // The inputs are handed out to the threads in chunks of this many, each taken by
+                // whichever thread gets to it first, so that a thread slowed down by, e.g., longer
+                // outputs or being descheduled does not hold up the others.
+                static constexpr stdr::size_t chunk_size = stdr::size_t(1) << 14;
+
+                // Calls func(chunk_index) for each chunk, on thread_count threads including the
+                // calling one.
+                template <class Func>
+                static void for_each_chunk(stdr::size_t number_of_chunks, unsigned int thread_count,
+                                           Func const& func) {
+                    std::atomic<stdr::size_t> next_chunk{0};
+                    auto work = [&] {
+                        for (auto idx = next_chunk.fetch_add(1, std::memory_order_relaxed);
+                             idx < number_of_chunks;
+                             idx = next_chunk.fetch_add(1, std::memory_order_relaxed)) {
+                            func(idx);
+                        }
+                    };
+
+                    std::vector<std::thread> threads;
+                    threads.reserve(thread_count - 1);
+                    try {
+                        for (unsigned int idx = 1; idx < thread_count; ++idx) {
+                            threads.emplace_back(work);
+                        }
+                    }
+                    catch (...) {
+                        // Destroying a joinable thread calls std::terminate, so the threads
+                        // already started should be joined first. No chunk is handed out to them
+                        // after this.
+                        next_chunk.store(number_of_chunks, std::memory_order_relaxed);
+                        for (auto& t : threads) {
+                            t.join();
+                        }
+                        throw;
+                    }
+                    work();
+                    for (auto& t : threads) {
+                        t.join();
+                    }
+                }
+
+                template <class Float>
+                static char* to_chars_n(Float const* first, Float const* last, char* buffer,
+                                        char delimiter, unsigned int thread_count) {
+                    using conversion_traits = default_float_bit_carrier_conversion_traits<Float>;
+                    using format = typename conversion_traits::format;
+                    using carrier_uint = typename conversion_traits::carrier_uint;
+                    // A zero significand marks inputs that are zero or not finite.
+                    using decimal_type = signed_decimal_fp<carrier_uint, int>;
+
+                    auto const number_of_inputs = stdr::size_t(last - first);
+                    auto const number_of_chunks = (number_of_inputs + chunk_size - 1) / chunk_size;
+                    if (thread_count == 0) {
+                        thread_count = std::thread::hardware_concurrency();
+                    }
+                    if (stdr::size_t(thread_count) > number_of_chunks) {
+                        thread_count = unsigned(number_of_chunks);
+                    }
+                    if (thread_count == 0) {
+                        thread_count = 1;
+                    }
+
+                    // Not value-initialized, since every entry is written in the first pass.
+                    std::unique_ptr<decimal_type[]> decimals(new decimal_type[number_of_inputs]);
+                    // The offset of each chunk into the output, computed from the lengths of the
+                    // chunks, which are stored into the next entry in the first pass.
+                    std::vector<stdr::size_t> offsets(number_of_chunks + 1);
+
+                    for_each_chunk(number_of_chunks, thread_count, [&](stdr::size_t chunk_idx) {
+                        auto const chunk_first = chunk_idx * chunk_size;
+                        auto const chunk_last = chunk_first + chunk_size < number_of_inputs
+                                                    ? chunk_first + chunk_size
+                                                    : number_of_inputs;
+                        stdr::size_t length = 0;
+                        for (auto idx = chunk_first; idx != chunk_last; ++idx) {
+                            auto const br = make_float_bits<Float>(first[idx]);
+                            if (br.is_finite() && br.is_nonzero()) {
+                                auto const result = to_decimal(first[idx]);
+                                decimals[idx] = {result.significand, result.exponent,
+                                                 result.is_negative};
+                                length += to_chars_length(result.significand, result.exponent) +
+                                          stdr::size_t(result.is_negative);
+                            }
+                            else {
+                                char temp[max_output_string_length_holder<format>::value];
+                                decimals[idx] = {0, 0, false};
+                                length += stdr::size_t(
+                                    JKJ_NAMESPACE::dragonbox::to_chars_n(first[idx], temp) - temp);
+                            }
+                        }
+                        offsets[chunk_idx + 1] = length + (chunk_last - chunk_first);
+                    });
+
+                    for (stdr::size_t chunk_idx = 0; chunk_idx < number_of_chunks; ++chunk_idx) {
+                        offsets[chunk_idx + 1] += offsets[chunk_idx];
+                    }
+
+                    for_each_chunk(number_of_chunks, thread_count, [&](stdr::size_t chunk_idx) {
+                        auto const chunk_first = chunk_idx * chunk_size;
+                        auto const chunk_last = chunk_first + chunk_size < number_of_inputs
+                                                    ? chunk_first + chunk_size
+                                                    : number_of_inputs;
+                        auto ptr = buffer + offsets[chunk_idx];
+                        for (auto idx = chunk_first; idx != chunk_last; ++idx) {
+                            auto const& decimal = decimals[idx];
+                            if (decimal.significand != 0) {
+                                if (decimal.is_negative) {
+                                    *ptr = '-';
+                                    ++ptr;
+                                }
+                                ptr = detail::to_chars<format>(decimal.significand, decimal.exponent,
+                                                               ptr);
+                            }
+                            else {
+                                ptr = JKJ_NAMESPACE::dragonbox::to_chars_n(first[idx], ptr);
+                            }
+                            *ptr = delimiter;
+                            ++ptr;
+                        }
+                        assert(ptr == buffer + offsets[chunk_idx + 1]);
+                    });
+
+                    return buffer + offsets[number_of_chunks];
+                }
+            }
+        }
+
+        char* parallel_to_chars_n(float const* first, float const* last, char* buffer,
+                                  char delimiter, unsigned int thread_count) {
+            return detail::parallel_impl::to_chars_n(first, last, buffer, delimiter, thread_count);
+        }
+
+        char* parallel_to_chars_n(double const* first, double const* last, char* buffer,
+                                  char delimiter, unsigned int thread_count) {
+            return detail::parallel_impl::to_chars_n(first, last, buffer, delimiter, thread_count);
+        }
+    }
+}
@@ -0,0 +1,210 @@
+// Copyright 2025 Junekey Jeon
+//
+// The contents of this file may be used under the terms of
+// the Apache License v2.0 with LLVM Exceptions.
+//
+//    (See accompanying file LICENSE-Apache or copy at
+//     https://llvm.org/foundation/relicensing/LICENSE.txt)
+//
+// Alternatively, the contents of this file may be used under the terms of
+// the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE-Boost or copy at
+//     https://www.boost.org/LICENSE_1_0.txt)
+//
+// Unless required by applicable law or agreed to in writing, this software
+// is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.
+
+#define JKJ_DRAGONBOX_TO_CHARS_LEAK_MACROS
+#include "dragonbox/dragonbox_to_chars.h"
+
+namespace JKJ_NAMESPACE {
+    namespace dragonbox {
+        namespace detail {
+            namespace runtime_impl {
+                // The kernels of to_decimal and to_chars_n. The latter prints the digits inside the
+                // kernel, so that the decimal result does not need to round-trip through memory.
+                // Parity-dependent modes are not split into separate kernels like the
+                // *_static_boundary policies do, since selecting the kernel from the input would
+                // make the indirect call unpredictable.
+                template <class FormatTraits>
+                struct to_decimal_kernel {
+                    using exponent_int = typename FormatTraits::exponent_int;
+                    using result_type =
+                        to_decimal_return_type<FormatTraits, policy::sign::ignore_t,
+                                               policy::trailing_zero::remove_t>;
+                    using function_type = result_type (*)(signed_significand_bits<FormatTraits>,
+                                                          exponent_int) noexcept;
+
+                    template <class DecimalToBinaryRoundingPolicy,
+                              class BinaryToDecimalRoundingPolicy>
+                    static result_type compute(signed_significand_bits<FormatTraits> s,
+                                               exponent_int exponent_bits) noexcept {
+                        return to_decimal_ex(s, exponent_bits, policy::sign::ignore,
+                                             policy::trailing_zero::remove,
+                                             DecimalToBinaryRoundingPolicy{},
+                                             BinaryToDecimalRoundingPolicy{});
+                    }
+                };
+
+                template <class FormatTraits>
+                struct to_chars_kernel {
+                    using exponent_int = typename FormatTraits::exponent_int;
+                    using function_type = char* (*)(signed_significand_bits<FormatTraits>,
+                                                    exponent_int, char*) noexcept;
+
+                    template <class DecimalToBinaryRoundingPolicy,
+                              class BinaryToDecimalRoundingPolicy>
+                    static char* compute(signed_significand_bits<FormatTraits> s,
+                                         exponent_int exponent_bits, char* buffer) noexcept {
+                        auto const result = to_decimal_ex(
+                            s, exponent_bits, policy::sign::ignore, policy::trailing_zero::ignore,
+                            DecimalToBinaryRoundingPolicy{}, BinaryToDecimalRoundingPolicy{});
+                        return detail::to_chars<typename FormatTraits::format>(
+                            result.significand, result.exponent, buffer);
+                    }
+                };
+
+                template <class Kernel>
+                struct kernel_table {
+                    using function_type = typename Kernel::function_type;
+
+                    // Indexed by binary_to_decimal_rounding.
+                    struct row {
+                        function_type kernels[5];
+                    };
+
+                    template <class DecimalToBinaryRoundingPolicy>
+                    static constexpr row nearest_row() noexcept {
+                        namespace b2d = policy::binary_to_decimal_rounding;
+                        return {{Kernel::template compute<DecimalToBinaryRoundingPolicy,
+                                                          b2d::do_not_care_t>,
+                                 Kernel::template compute<DecimalToBinaryRoundingPolicy,
+                                                          b2d::to_even_t>,
+                                 Kernel::template compute<DecimalToBinaryRoundingPolicy,
+                                                          b2d::to_odd_t>,
+                                 Kernel::template compute<DecimalToBinaryRoundingPolicy,
+                                                          b2d::away_from_zero_t>,
+                                 Kernel::template compute<DecimalToBinaryRoundingPolicy,
+                                                          b2d::toward_zero_t>}};
+                    }
+
+                    // Binary-to-decimal rounding is irrelevant for directed rounding.
+                    template <class DecimalToBinaryRoundingPolicy>
+                    static constexpr row directed_row() noexcept {
+                        return {{Kernel::template compute<
+                                     DecimalToBinaryRoundingPolicy,
+                                     policy::binary_to_decimal_rounding::do_not_care_t>}};
+                    }
+
+                    // Indices into the table below. Once the sign is known, the modes rounding
+                    // toward or away from an infinity are the ones rounding toward or away from
+                    // zero, so only the latter are instantiated.
+                    enum row_index : unsigned char {
+                        nearest_to_even,
+                        nearest_to_odd,
+                        nearest_toward_zero,
+                        nearest_away_from_zero,
+                        toward_zero,
+                        away_from_zero
+                    };
+
+                    static function_type select(runtime::policies p, bool is_negative) noexcept {
+                        namespace d2b = policy::decimal_to_binary_rounding;
+                        // Indexed by row_index.
+                        static constexpr row table[] = {
+                            nearest_row<d2b::nearest_to_even_t>(),
+                            nearest_row<d2b::nearest_to_odd_t>(),
+                            nearest_row<d2b::nearest_toward_zero_t>(),
+                            nearest_row<d2b::nearest_away_from_zero_t>(),
+                            directed_row<d2b::toward_zero_t>(),
+                            directed_row<d2b::away_from_zero_t>()};
+                        // Indexed by decimal_to_binary_rounding and then by whether the input is
+                        // negative.
+                        static constexpr row_index row_indices[][2] = {
+                            {nearest_to_even, nearest_to_even},
+                            {nearest_to_odd, nearest_to_odd},
+                            {nearest_away_from_zero, nearest_toward_zero},
+                            {nearest_toward_zero, nearest_away_from_zero},
+                            {nearest_toward_zero, nearest_toward_zero},
+                            {nearest_away_from_zero, nearest_away_from_zero},
+                            {away_from_zero, toward_zero},
+                            {toward_zero, away_from_zero},
+                            {toward_zero, toward_zero},
+                            {away_from_zero, away_from_zero}};
+
+                        // Values outside of the enumerators would read past the tables.
+                        assert(stdr::size_t(p.decimal_to_binary) <
+                               sizeof(row_indices) / sizeof(row_indices[0]));
+                        auto const index =
+                            row_indices[stdr::size_t(p.decimal_to_binary)][is_negative ? 1 : 0];
+                        auto const& kernels = table[index].kernels;
+                        if (index >= toward_zero) {
+                            return kernels[0];
+                        }
+                        assert(stdr::size_t(p.binary_to_decimal) <
+                               sizeof(kernels) / sizeof(kernels[0]));
+                        return kernels[stdr::size_t(p.binary_to_decimal)];
+                    }
+                };
+
+                template <class FormatTraits>
+                static signed_decimal_fp<typename FormatTraits::carrier_uint, int>
+                to_decimal(float_bits<FormatTraits> br, runtime::policies p) noexcept {
+                    auto const exponent_bits = br.extract_exponent_bits();
+                    auto const s = br.remove_exponent_bits();
+                    assert(br.is_finite() && br.is_nonzero());
+
+                    auto const result =
+                        kernel_table<to_decimal_kernel<FormatTraits>>::select(p, s.is_negative())(
+                            s, exponent_bits);
+                    return {result.significand, int(result.exponent), s.is_negative()};
+                }
+
+                template <class FormatTraits>
+                static char* to_chars_n(float_bits<FormatTraits> br, char* buffer,
+                                        runtime::policies p) noexcept {
+                    auto const exponent_bits = br.extract_exponent_bits();
+                    auto const s = br.remove_exponent_bits();
+
+                    if (!br.is_finite(exponent_bits) || !br.is_nonzero()) {
+                        // The output does not depend on the rounding modes.
+                        return to_chars_n_impl<
+                            policy::decimal_to_binary_rounding::nearest_to_even_t,
+                            policy::binary_to_decimal_rounding::to_even_t, policy::cache::full_t,
+                            policy::preferred_integer_types::match_t, policy::branching::branchy_t,
+                            policy::integer_fast_path::disabled_t, policy::digit_generation::fast_t>(
+                            br, buffer);
+                    }
+
+                    if (s.is_negative()) {
+                        *buffer = '-';
+                        ++buffer;
+                    }
+                    return kernel_table<to_chars_kernel<FormatTraits>>::select(
+                        p, s.is_negative())(s, exponent_bits, buffer);
+                }
+            }
+        }
+
+        namespace runtime {
+            signed_decimal_fp<detail::stdr::uint_least32_t, int> to_decimal(float x,
+                                                                           policies p) noexcept {
+                return detail::runtime_impl::to_decimal(make_float_bits<float>(x), p);
+            }
+
+            signed_decimal_fp<detail::stdr::uint_least64_t, int> to_decimal(double x,
+                                                                            policies p) noexcept {
+                return detail::runtime_impl::to_decimal(make_float_bits<double>(x), p);
+            }
+
+            char* to_chars_n(float x, char* buffer, policies p) noexcept {
+                return detail::runtime_impl::to_chars_n(make_float_bits<float>(x), buffer, p);
+            }
+
+            char* to_chars_n(double x, char* buffer, policies p) noexcept {
+                return detail::runtime_impl::to_chars_n(make_float_bits<double>(x), buffer, p);
+            }
+        }
+    }
+}
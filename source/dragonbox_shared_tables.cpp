@@ -0,0 +1,86 @@
+// Copyright 2025 Junekey Jeon
+//
+// The contents of this file may be used under the terms of
+// the Apache License v2.0 with LLVM Exceptions.
+//
+//    (See accompanying file LICENSE-Apache or copy at
+//     https://llvm.org/foundation/relicensing/LICENSE.txt)
+//
+// Alternatively, the contents of this file may be used under the terms of
+// the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE-Boost or copy at
+//     https://www.boost.org/LICENSE_1_0.txt)
+//
+// Unless required by applicable law or agreed to in writing, this software
+// is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.
+
+// The only definitions of the cache tables declared extern by JKJ_DRAGONBOX_SHARED_TABLES in
+// dragonbox.h.
+
+#define JKJ_DRAGONBOX_LEAK_MACROS
+#include "dragonbox/dragonbox.h"
+
+#include <type_traits>
+
+#if !JKJ_DRAGONBOX_SHARED_TABLES
+    #error "This file should be compiled with JKJ_DRAGONBOX_SHARED_TABLES defined to be 1."
+#endif
+
+namespace JKJ_NAMESPACE {
+    namespace dragonbox {
+        namespace detail {
+            namespace shared_tables {
+                namespace {
+                    template <class Table, class Source>
+                    constexpr Table copy_table(Source const& source) {
+                        std::remove_const_t<Table> res{};
+                        for (stdr::size_t i = 0; i < sizeof(res.data_) / sizeof(res.data_[0]);
+                             ++i) {
+                            res.data_[i] = source[i];
+                        }
+                        return res;
+                    }
+
+                    // Stores each entry as its upper half followed by its lower half.
+                    template <class Table, class Source>
+                    constexpr Table split_table(Source const& source) {
+                        std::remove_const_t<Table> res{};
+                        for (stdr::size_t i = 0; i < sizeof(res.data_) / sizeof(res.data_[0]) / 2;
+                             ++i) {
+                            res.data_[i * 2] = source[i].high();
+                            res.data_[i * 2 + 1] = source[i].low();
+                        }
+                        return res;
+                    }
+                }
+
+                // The declarations are already decorated with JKJ_DRAGONBOX_TABLE_API.
+                extern "C" {
+                decltype(jkj_dragonbox_binary32_cache) jkj_dragonbox_binary32_cache
+                    JKJ_STATIC_DATA_SECTION = copy_table<decltype(jkj_dragonbox_binary32_cache)>(
+                        cache_holder<ieee754_binary32>::cache);
+                decltype(jkj_dragonbox_binary64_cache) jkj_dragonbox_binary64_cache
+                    JKJ_STATIC_DATA_SECTION = split_table<decltype(jkj_dragonbox_binary64_cache)>(
+                        cache_holder<ieee754_binary64>::cache);
+                decltype(jkj_dragonbox_binary32_compressed_cache)
+                    jkj_dragonbox_binary32_compressed_cache JKJ_STATIC_DATA_SECTION =
+                        copy_table<decltype(jkj_dragonbox_binary32_compressed_cache)>(
+                            compressed_cache_holder<ieee754_binary32>::cache);
+                decltype(jkj_dragonbox_binary32_pow5_table) jkj_dragonbox_binary32_pow5_table
+                    JKJ_STATIC_DATA_SECTION =
+                        copy_table<decltype(jkj_dragonbox_binary32_pow5_table)>(
+                            compressed_cache_holder<ieee754_binary32>::pow5_table);
+                decltype(jkj_dragonbox_binary64_compressed_cache)
+                    jkj_dragonbox_binary64_compressed_cache JKJ_STATIC_DATA_SECTION =
+                        split_table<decltype(jkj_dragonbox_binary64_compressed_cache)>(
+                            compressed_cache_holder<ieee754_binary64>::cache);
+                decltype(jkj_dragonbox_binary64_pow5_table) jkj_dragonbox_binary64_pow5_table
+                    JKJ_STATIC_DATA_SECTION =
+                        copy_table<decltype(jkj_dragonbox_binary64_pow5_table)>(
+                            compressed_cache_holder<ieee754_binary64>::pow5_table);
+                }
+            }
+        }
+    }
+}
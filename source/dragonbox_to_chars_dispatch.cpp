@@ -0,0 +1,226 @@
+// Copyright 2025 Junekey Jeon
+//
+// The contents of this file may be used under the terms of
+// the Apache License v2.0 with LLVM Exceptions.
+//
+//    (See accompanying file LICENSE-Apache or copy at
+//     https://llvm.org/foundation/relicensing/LICENSE.txt)
+//
+// Alternatively, the contents of this file may be used under the terms of
+// the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE-Boost or copy at
+//     https://www.boost.org/LICENSE_1_0.txt)
+//
+// Unless required by applicable law or agreed to in writing, this software
+// is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.
+
+#define JKJ_DRAGONBOX_TO_CHARS_LEAK_MACROS
+#include "dragonbox/dragonbox_to_chars.h"
+#include <atomic>
+
+#ifndef JKJ_DRAGONBOX_TO_CHARS_ISA_DISPATCH
+    #error "This file should be compiled with JKJ_DRAGONBOX_TO_CHARS_ISA_DISPATCH defined."
+#endif
+
+#if JKJ_DRAGONBOX_TO_CHARS_HAS_X86_64_VARIANTS
+// Defined in dragonbox_to_chars_isa_variant.cpp, which is compiled once for each of these namespaces.
+namespace jkj_dragonbox_x86_64_v2 {
+    namespace dragonbox {
+        namespace detail {
+            char* to_chars_n_binary32(std::uint_least32_t bit_pattern, char* buffer) noexcept;
+            char* to_chars_n_binary64(std::uint_least64_t bit_pattern, char* buffer) noexcept;
+        }
+    }
+}
+namespace jkj_dragonbox_x86_64_v3 {
+    namespace dragonbox {
+        namespace detail {
+            char* to_chars_n_binary32(std::uint_least32_t bit_pattern, char* buffer) noexcept;
+            char* to_chars_n_binary64(std::uint_least64_t bit_pattern, char* buffer) noexcept;
+        }
+    }
+}
+namespace jkj_dragonbox_x86_64_v4 {
+    namespace dragonbox {
+        namespace detail {
+            char* to_chars_n_binary32(std::uint_least32_t bit_pattern, char* buffer) noexcept;
+            char* to_chars_n_binary64(std::uint_least64_t bit_pattern, char* buffer) noexcept;
+        }
+    }
+}
+#endif
+
+#if JKJ_DRAGONBOX_TO_CHARS_PGO_USE
+// Defined in dragonbox_to_chars_isa_variant.cpp compiled without the profile.
+namespace jkj_dragonbox_without_profile {
+    namespace dragonbox {
+        namespace detail {
+            char* to_chars_n_binary32(std::uint_least32_t bit_pattern, char* buffer) noexcept;
+            char* to_chars_n_binary64(std::uint_least64_t bit_pattern, char* buffer) noexcept;
+        }
+    }
+}
+#endif
+
+namespace JKJ_NAMESPACE {
+    namespace dragonbox {
+        namespace detail {
+            template <class FormatTraits>
+            static char* to_chars_n_baseline(typename FormatTraits::carrier_uint bit_pattern,
+                                             char* buffer) noexcept {
+                return to_chars_n_impl<policy::decimal_to_binary_rounding::nearest_to_even_t,
+                                       policy::binary_to_decimal_rounding::to_even_t,
+                                       policy::cache::full_t, policy::preferred_integer_types::match_t,
+                                       policy::branching::branchy_t,
+                                       policy::integer_fast_path::disabled_t,
+                                       policy::digit_generation::fast_t>(
+                    float_bits<FormatTraits>(bit_pattern), buffer);
+            }
+
+            static isa_level detect_isa_level() noexcept {
+#if JKJ_DRAGONBOX_TO_CHARS_HAS_X86_64_VARIANTS
+                __builtin_cpu_init();
+                if (__builtin_cpu_supports("x86-64-v4")) {
+                    return isa_level::x86_64_v4;
+                }
+                if (__builtin_cpu_supports("x86-64-v3")) {
+                    return isa_level::x86_64_v3;
+                }
+                if (__builtin_cpu_supports("x86-64-v2")) {
+                    return isa_level::x86_64_v2;
+                }
+#endif
+                return isa_level::baseline;
+            }
+
+            isa_level selected_isa_level() noexcept {
+                static isa_level const level = detect_isa_level();
+                return level;
+            }
+
+            template <class FloatFormat, class CarrierUInt>
+            struct isa_variants;
+
+            template <>
+            struct isa_variants<ieee754_binary32, stdr::uint_least32_t> {
+                using function_type = char* (*)(stdr::uint_least32_t, char*) noexcept;
+                static function_type get(isa_level level) noexcept {
+                    switch (level) {
+#if JKJ_DRAGONBOX_TO_CHARS_HAS_X86_64_VARIANTS
+                    case isa_level::x86_64_v4:
+                        return jkj_dragonbox_x86_64_v4::dragonbox::detail::to_chars_n_binary32;
+                    case isa_level::x86_64_v3:
+                        return jkj_dragonbox_x86_64_v3::dragonbox::detail::to_chars_n_binary32;
+                    case isa_level::x86_64_v2:
+                        return jkj_dragonbox_x86_64_v2::dragonbox::detail::to_chars_n_binary32;
+#endif
+                    case isa_level::baseline:
+                        return to_chars_n_baseline<
+                            ieee754_binary_traits<ieee754_binary32, stdr::uint_least32_t>>;
+                    default:
+                        return nullptr;
+                    }
+                }
+            };
+
+            template <>
+            struct isa_variants<ieee754_binary64, stdr::uint_least64_t> {
+                using function_type = char* (*)(stdr::uint_least64_t, char*) noexcept;
+                static function_type get(isa_level level) noexcept {
+                    switch (level) {
+#if JKJ_DRAGONBOX_TO_CHARS_HAS_X86_64_VARIANTS
+                    case isa_level::x86_64_v4:
+                        return jkj_dragonbox_x86_64_v4::dragonbox::detail::to_chars_n_binary64;
+                    case isa_level::x86_64_v3:
+                        return jkj_dragonbox_x86_64_v3::dragonbox::detail::to_chars_n_binary64;
+                    case isa_level::x86_64_v2:
+                        return jkj_dragonbox_x86_64_v2::dragonbox::detail::to_chars_n_binary64;
+#endif
+                    case isa_level::baseline:
+                        return to_chars_n_baseline<
+                            ieee754_binary_traits<ieee754_binary64, stdr::uint_least64_t>>;
+                    default:
+                        return nullptr;
+                    }
+                }
+            };
+
+            // The pointer to the selected copy starts out pointing to a resolver, so that calls made
+            // during static initialization of other translation units still work. The dynamic
+            // initializer below replaces it with the selected copy as soon as the library is loaded.
+            template <class FloatFormat, class CarrierUInt>
+            struct isa_dispatch {
+                using function_type = typename isa_variants<FloatFormat, CarrierUInt>::function_type;
+
+                static char* resolve(CarrierUInt bit_pattern, char* buffer) noexcept {
+                    auto const f = isa_variants<FloatFormat, CarrierUInt>::get(selected_isa_level());
+                    selected.store(f, std::memory_order_relaxed);
+                    return f(bit_pattern, buffer);
+                }
+
+                static std::atomic<function_type> selected;
+            };
+
+            template <class FloatFormat, class CarrierUInt>
+            std::atomic<typename isa_dispatch<FloatFormat, CarrierUInt>::function_type>
+                isa_dispatch<FloatFormat, CarrierUInt>::selected{
+                    isa_dispatch<FloatFormat, CarrierUInt>::resolve};
+
+            static bool const isa_dispatch_initializer = [] {
+                auto const level = selected_isa_level();
+                isa_dispatch<ieee754_binary32, stdr::uint_least32_t>::selected.store(
+                    isa_variants<ieee754_binary32, stdr::uint_least32_t>::get(level),
+                    std::memory_order_relaxed);
+                isa_dispatch<ieee754_binary64, stdr::uint_least64_t>::selected.store(
+                    isa_variants<ieee754_binary64, stdr::uint_least64_t>::get(level),
+                    std::memory_order_relaxed);
+                return true;
+            }();
+
+            template <>
+            char* (*get_isa_variant<ieee754_binary32, stdr::uint_least32_t>(isa_level level) noexcept)(
+                stdr::uint_least32_t, char*) {
+                return level <= selected_isa_level()
+                           ? isa_variants<ieee754_binary32, stdr::uint_least32_t>::get(level)
+                           : nullptr;
+            }
+
+            template <>
+            char* (*get_isa_variant<ieee754_binary64, stdr::uint_least64_t>(isa_level level) noexcept)(
+                stdr::uint_least64_t, char*) {
+                return level <= selected_isa_level()
+                           ? isa_variants<ieee754_binary64, stdr::uint_least64_t>::get(level)
+                           : nullptr;
+            }
+
+            template <>
+            char* to_chars_n_dispatched<ieee754_binary32, stdr::uint_least32_t>(
+                stdr::uint_least32_t bit_pattern, char* buffer) noexcept {
+                return isa_dispatch<ieee754_binary32, stdr::uint_least32_t>::selected.load(
+                    std::memory_order_relaxed)(bit_pattern, buffer);
+            }
+
+            template <>
+            char* to_chars_n_dispatched<ieee754_binary64, stdr::uint_least64_t>(
+                stdr::uint_least64_t bit_pattern, char* buffer) noexcept {
+                return isa_dispatch<ieee754_binary64, stdr::uint_least64_t>::selected.load(
+                    std::memory_order_relaxed)(bit_pattern, buffer);
+            }
+
+#if JKJ_DRAGONBOX_TO_CHARS_PGO_USE
+            template <>
+            char* (*get_variant_without_profile<ieee754_binary32, stdr::uint_least32_t>() noexcept)(
+                stdr::uint_least32_t, char*) {
+                return jkj_dragonbox_without_profile::dragonbox::detail::to_chars_n_binary32;
+            }
+
+            template <>
+            char* (*get_variant_without_profile<ieee754_binary64, stdr::uint_least64_t>() noexcept)(
+                stdr::uint_least64_t, char*) {
+                return jkj_dragonbox_without_profile::dragonbox::detail::to_chars_n_binary64;
+            }
+#endif
+        }
+    }
+}
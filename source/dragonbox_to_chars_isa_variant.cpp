@@ -0,0 +1,63 @@
+// Copyright 2025 Junekey Jeon
+//
+// The contents of this file may be used under the terms of
+// the Apache License v2.0 with LLVM Exceptions.
+//
+//    (See accompanying file LICENSE-Apache or copy at
+//     https://llvm.org/foundation/relicensing/LICENSE.txt)
+//
+// Alternatively, the contents of this file may be used under the terms of
+// the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE-Boost or copy at
+//     https://www.boost.org/LICENSE_1_0.txt)
+//
+// Unless required by applicable law or agreed to in writing, this software
+// is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.
+
+// This file is compiled once for each instruction set level supported by the runtime ISA dispatch,
+// with the corresponding -march flag and with JKJ_NAMESPACE set to a namespace specific to that
+// level. Since it contains a complete copy of dragonbox_to_chars.cpp, both the digit printer and
+// the instance of compute_nearest it calls are compiled for that level, and the separate namespace
+// prevents the linker from merging them with the baseline instances. When dragonbox_to_chars is
+// built with profile-guided optimization, it is also compiled once more without the profile, to
+// serve as the reference to compare against. The cache tables are not copied, since all these
+// copies are compiled with JKJ_DRAGONBOX_SHARED_TABLES.
+
+// The instances of the main algorithm in dragonbox_extern_templates live in the usual namespace.
+#undef JKJ_DRAGONBOX_EXTERN_TEMPLATES
+
+#include "dragonbox_to_chars.cpp"
+
+namespace JKJ_NAMESPACE {
+    namespace dragonbox {
+        namespace detail {
+            char* to_chars_n_binary32(stdr::uint_least32_t bit_pattern, char* buffer) noexcept;
+            char* to_chars_n_binary64(stdr::uint_least64_t bit_pattern, char* buffer) noexcept;
+
+            char* to_chars_n_binary32(stdr::uint_least32_t bit_pattern, char* buffer) noexcept {
+                return to_chars_n_impl<policy::decimal_to_binary_rounding::nearest_to_even_t,
+                                       policy::binary_to_decimal_rounding::to_even_t,
+                                       policy::cache::full_t, policy::preferred_integer_types::match_t,
+                                       policy::branching::branchy_t,
+                                       policy::integer_fast_path::disabled_t,
+                                       policy::digit_generation::fast_t>(
+                    float_bits<ieee754_binary_traits<ieee754_binary32, stdr::uint_least32_t>>(
+                        bit_pattern),
+                    buffer);
+            }
+
+            char* to_chars_n_binary64(stdr::uint_least64_t bit_pattern, char* buffer) noexcept {
+                return to_chars_n_impl<policy::decimal_to_binary_rounding::nearest_to_even_t,
+                                       policy::binary_to_decimal_rounding::to_even_t,
+                                       policy::cache::full_t, policy::preferred_integer_types::match_t,
+                                       policy::branching::branchy_t,
+                                       policy::integer_fast_path::disabled_t,
+                                       policy::digit_generation::fast_t>(
+                    float_bits<ieee754_binary_traits<ieee754_binary64, stdr::uint_least64_t>>(
+                        bit_pattern),
+                    buffer);
+            }
+        }
+    }
+}
@@ -0,0 +1,111 @@
+// Copyright 2025 Junekey Jeon
+//
+// The contents of this file may be used under the terms of
+// the Apache License v2.0 with LLVM Exceptions.
+//
+//    (See accompanying file LICENSE-Apache or copy at
+//     https://llvm.org/foundation/relicensing/LICENSE.txt)
+//
+// Alternatively, the contents of this file may be used under the terms of
+// the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE-Boost or copy at
+//     https://www.boost.org/LICENSE_1_0.txt)
+//
+// Unless required by applicable law or agreed to in writing, this software
+// is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.
+
+// Training workload for the profile-guided optimization of dragonbox_to_chars (see the CMake option
+// DRAGONBOX_TO_CHARS_PGO). It runs to_chars_n with the default policies over uniformly random bit
+// patterns and over inputs with each number of decimal digits, so that the collected profile
+// reflects both inputs with few decimal digits, which dominate real-world data, and the worst case.
+// The seed is fixed, so that the profile does not change between runs.
+//
+// Usage: dragonbox_to_chars_pgo_training [--count N]
+
+#include "dragonbox/dragonbox_to_chars.h"
+
+#include <cmath>
+#include <cstdlib>
+#include <iostream>
+#include <limits>
+#include <random>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+
+template <class Float>
+static Float to_float(std::string const& str) {
+    if constexpr (std::is_same_v<Float, float>) {
+        return std::strtof(str.c_str(), nullptr);
+    }
+    else {
+        return std::strtod(str.c_str(), nullptr);
+    }
+}
+
+template <class Float>
+static std::size_t train(std::string_view float_name, std::size_t number_of_samples) {
+    using conversion_traits = jkj::dragonbox::default_float_bit_carrier_conversion_traits<Float>;
+    using carrier_uint = typename conversion_traits::carrier_uint;
+    constexpr auto max_digits = unsigned(std::numeric_limits<Float>::max_digits10);
+
+    std::mt19937_64 rg{0x5eed};
+    std::vector<Float> samples;
+    samples.reserve(number_of_samples * max_digits);
+
+    // Uniformly random bit patterns of finite numbers, which mostly have the maximum number of
+    // digits.
+    while (samples.size() < number_of_samples) {
+        auto const x = conversion_traits::carrier_to_float(
+            std::uniform_int_distribution<carrier_uint>{}(rg));
+        if (std::isfinite(x)) {
+            samples.push_back(x);
+        }
+    }
+
+    // Inputs with the given number of significant digits and an exponent near zero.
+    std::uniform_int_distribution<int> exponent_distribution{-20, 20};
+    for (unsigned int digits = 1; digits < max_digits; ++digits) {
+        unsigned long long from = 1;
+        for (unsigned int e = 1; e < digits; ++e) {
+            from *= 10;
+        }
+        std::uniform_int_distribution<unsigned long long> significand_distribution{
+            from, from * 10 - 1};
+        for (std::size_t i = 0; i < number_of_samples; ++i) {
+            samples.push_back(to_float<Float>(std::to_string(significand_distribution(rg)) + 'e' +
+                                              std::to_string(exponent_distribution(rg))));
+        }
+    }
+
+    std::cout << "Training with " << samples.size() << " samples for " << float_name << "...\n";
+
+    // The total length is printed so that the calls cannot be optimized away.
+    char buffer[64];
+    std::size_t total_length = 0;
+    for (auto x : samples) {
+        total_length += std::size_t(jkj::dragonbox::to_chars_n(x, buffer) - buffer);
+    }
+    return total_length;
+}
+
+int main(int argc, char** argv) {
+    std::size_t number_of_samples = 100000;
+
+    for (int i = 1; i < argc; ++i) {
+        std::string_view arg = argv[i];
+        if (arg == "--count" && i + 1 < argc) {
+            number_of_samples = std::strtoull(argv[++i], nullptr, 10);
+        }
+        else {
+            std::cerr << "Usage: " << argv[0] << " [--count N]\n";
+            return -1;
+        }
+    }
+
+    auto total_length = train<float>("binary32", number_of_samples);
+    total_length += train<double>("binary64", number_of_samples);
+    std::cout << "Done. (" << total_length << " characters written)\n";
+}
@@ -0,0 +1,47 @@
+// Copyright 2025 Junekey Jeon
+//
+// The contents of this file may be used under the terms of
+// the Apache License v2.0 with LLVM Exceptions.
+//
+//    (See accompanying file LICENSE-Apache or copy at
+//     https://llvm.org/foundation/relicensing/LICENSE.txt)
+//
+// Alternatively, the contents of this file may be used under the terms of
+// the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE-Boost or copy at
+//     https://www.boost.org/LICENSE_1_0.txt)
+//
+// Unless required by applicable law or agreed to in writing, this software
+// is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.
+
+#ifndef JKJ_THROUGHPUT_BENCHMARK
+#define JKJ_THROUGHPUT_BENCHMARK
+
+#include <cstddef>
+#include <string_view>
+
+// An array formatter writes every element of [first, last) into buffer, each one followed by the
+// delimiter, and returns the end of the written range. The buffer is guaranteed to have at least
+// max_bytes_per_value bytes of room per element.
+template <class Float>
+using array_formatter = char* (*)(Float const* first, Float const* last, char* buffer,
+                                  char delimiter);
+
+inline constexpr std::size_t max_bytes_per_value = 48;
+
+struct register_function_for_throughput_benchmark {
+    register_function_for_throughput_benchmark() = default;
+
+    register_function_for_throughput_benchmark(std::string_view name,
+                                               array_formatter<float> func);
+
+    register_function_for_throughput_benchmark(std::string_view name,
+                                               array_formatter<double> func);
+
+    register_function_for_throughput_benchmark(std::string_view name,
+                                               array_formatter<float> func_float,
+                                               array_formatter<double> func_double);
+};
+
+#endif
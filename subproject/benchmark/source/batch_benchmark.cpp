@@ -0,0 +1,205 @@
+// Copyright 2025 Junekey Jeon
+//
+// The contents of this file may be used under the terms of
+// the Apache License v2.0 with LLVM Exceptions.
+//
+//    (See accompanying file LICENSE-Apache or copy at
+//     https://llvm.org/foundation/relicensing/LICENSE.txt)
+//
+// Alternatively, the contents of this file may be used under the terms of
+// the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE-Boost or copy at
+//     https://www.boost.org/LICENSE_1_0.txt)
+//
+// Unless required by applicable law or agreed to in writing, this software
+// is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.
+
+// Batch conversion benchmark: compares jkj::dragonbox::to_decimal_batch against calling
+// jkj::dragonbox::to_decimal for each element of a column, and jkj::dragonbox::formatted_length and
+// formatted_length_batch against measuring the output of jkj::dragonbox::to_chars_n, and reports
+// the average time per value for columns of different exponent distributions.
+//
+// Usage: batch_benchmark [--count N] [--repeat R]
+
+#include "dragonbox/dragonbox_to_chars.h"
+#include "random_float.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <limits>
+#include <random>
+#include <string_view>
+#include <vector>
+
+template <class Float>
+using result_type = decltype(jkj::dragonbox::to_decimal(Float(1)));
+
+template <class Float>
+static result_type<Float>* per_element(Float const* first, Float const* last,
+                                       result_type<Float>* output) {
+    for (; first != last; ++first, ++output) {
+        *output = jkj::dragonbox::to_decimal(*first);
+    }
+    return output;
+}
+
+template <class Float>
+static result_type<Float>* batch(Float const* first, Float const* last,
+                                 result_type<Float>* output) {
+    return jkj::dragonbox::to_decimal_batch(first, last, output);
+}
+
+template <class Float>
+static void run(std::string_view profile_name, std::vector<Float> const& samples,
+                std::size_t number_of_repetitions) {
+    using converter = result_type<Float>* (*)(Float const*, Float const*, result_type<Float>*);
+    struct name_func_pair {
+        std::string_view name;
+        converter func;
+    };
+    name_func_pair const name_func_pairs[] = {{"to_decimal", per_element<Float>},
+                                              {"to_decimal_batch", batch<Float>}};
+
+    std::vector<result_type<Float>> results(samples.size());
+    std::cout << profile_name << ":\n";
+    for (auto const& p : name_func_pairs) {
+        auto best = std::numeric_limits<double>::infinity();
+        for (std::size_t i = 0; i < number_of_repetitions; ++i) {
+            auto from = std::chrono::steady_clock::now();
+            p.func(samples.data(), samples.data() + samples.size(), results.data());
+            auto dur = std::chrono::steady_clock::now() - from;
+            best = std::min(best, std::chrono::duration<double>(dur).count());
+        }
+        std::cout << "  " << std::left << std::setw(22) << p.name << std::right << std::fixed
+                  << std::setprecision(2) << std::setw(8) << best * 1e9 / double(samples.size())
+                  << " ns/value\n";
+    }
+}
+
+template <class Float>
+static std::size_t length_by_to_chars_n(Float const* first, Float const* last,
+                                        std::size_t* lengths) {
+    std::size_t total_length = 0;
+    for (; first != last; ++first, ++lengths) {
+        char buffer[32];
+        *lengths = std::size_t(jkj::dragonbox::to_chars_n(*first, buffer) - buffer);
+        total_length += *lengths;
+    }
+    return total_length;
+}
+
+template <class Float>
+static std::size_t length_per_element(Float const* first, Float const* last,
+                                      std::size_t* lengths) {
+    std::size_t total_length = 0;
+    for (; first != last; ++first, ++lengths) {
+        *lengths = jkj::dragonbox::formatted_length(*first);
+        total_length += *lengths;
+    }
+    return total_length;
+}
+
+template <class Float>
+static std::size_t length_batch(Float const* first, Float const* last, std::size_t* lengths) {
+    return jkj::dragonbox::formatted_length_batch(first, last, lengths);
+}
+
+template <class Float>
+static void run_length(std::vector<Float> const& samples, std::size_t number_of_repetitions) {
+    using measurer = std::size_t (*)(Float const*, Float const*, std::size_t*);
+    struct name_func_pair {
+        std::string_view name;
+        measurer func;
+    };
+    name_func_pair const name_func_pairs[] = {{"to_chars_n", length_by_to_chars_n<Float>},
+                                              {"formatted_length", length_per_element<Float>},
+                                              {"formatted_length_batch", length_batch<Float>}};
+
+    std::vector<std::size_t> lengths(samples.size());
+    for (auto const& p : name_func_pairs) {
+        auto best = std::numeric_limits<double>::infinity();
+        for (std::size_t i = 0; i < number_of_repetitions; ++i) {
+            auto from = std::chrono::steady_clock::now();
+            p.func(samples.data(), samples.data() + samples.size(), lengths.data());
+            auto dur = std::chrono::steady_clock::now() - from;
+            best = std::min(best, std::chrono::duration<double>(dur).count());
+        }
+        std::cout << "  " << std::left << std::setw(22) << p.name << std::right << std::fixed
+                  << std::setprecision(2) << std::setw(8) << best * 1e9 / double(samples.size())
+                  << " ns/value\n";
+    }
+}
+
+// Every value has the same exponent bits.
+template <class Float>
+static std::vector<Float> generate_single_binade(std::size_t number_of_samples) {
+    auto rg = generate_correctly_seeded_mt19937_64();
+    std::uniform_real_distribution<Float> dist{Float(16), Float(32)};
+    std::vector<Float> samples(number_of_samples);
+    for (auto& x : samples) {
+        x = dist(rg);
+    }
+    return samples;
+}
+
+// A slowly moving series, like a column of sensor readings or prices, so that runs of the same
+// exponent bits are long but not the whole column.
+template <class Float>
+static std::vector<Float> generate_random_walk(std::size_t number_of_samples) {
+    auto rg = generate_correctly_seeded_mt19937_64();
+    std::normal_distribution<Float> step{Float(0), Float(0.01)};
+    std::vector<Float> samples(number_of_samples);
+    Float x = 100;
+    for (auto& y : samples) {
+        x = std::clamp(x * (1 + step(rg)), Float(1), Float(10000));
+        y = x;
+    }
+    return samples;
+}
+
+// Uniformly random bit patterns, so the exponent bits almost never repeat.
+template <class Float>
+static std::vector<Float> generate_uniform(std::size_t number_of_samples) {
+    auto rg = generate_correctly_seeded_mt19937_64();
+    std::vector<Float> samples(number_of_samples);
+    for (auto& x : samples) {
+        do {
+            x = uniformly_randomly_generate_finite_float<Float>(rg);
+        } while (x == 0);
+    }
+    return samples;
+}
+
+int main(int argc, char** argv) {
+    std::size_t number_of_samples = 10000000;
+    std::size_t number_of_repetitions = 5;
+
+    for (int i = 1; i < argc; ++i) {
+        std::string_view arg = argv[i];
+        if (arg == "--count" && i + 1 < argc) {
+            number_of_samples = std::strtoull(argv[++i], nullptr, 10);
+        }
+        else if (arg == "--repeat" && i + 1 < argc) {
+            number_of_repetitions = std::strtoull(argv[++i], nullptr, 10);
+        }
+        else {
+            std::cerr << "Usage: " << argv[0] << " [--count N] [--repeat R]\n";
+            return -1;
+        }
+    }
+
+    auto const run_all = [&](std::string_view profile_name, auto const& samples) {
+        run(profile_name, samples, number_of_repetitions);
+        run_length(samples, number_of_repetitions);
+    };
+    run_all("binary32, [16, 32)", generate_single_binade<float>(number_of_samples));
+    run_all("binary32, random walk", generate_random_walk<float>(number_of_samples));
+    run_all("binary32, uniform", generate_uniform<float>(number_of_samples));
+    run_all("binary64, [16, 32)", generate_single_binade<double>(number_of_samples));
+    run_all("binary64, random walk", generate_random_walk<double>(number_of_samples));
+    run_all("binary64, uniform", generate_uniform<double>(number_of_samples));
+}
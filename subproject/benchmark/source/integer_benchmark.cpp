@@ -0,0 +1,142 @@
+// Copyright 2025 Junekey Jeon
+//
+// The contents of this file may be used under the terms of
+// the Apache License v2.0 with LLVM Exceptions.
+//
+//    (See accompanying file LICENSE-Apache or copy at
+//     https://llvm.org/foundation/relicensing/LICENSE.txt)
+//
+// Alternatively, the contents of this file may be used under the terms of
+// the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE-Boost or copy at
+//     https://www.boost.org/LICENSE_1_0.txt)
+//
+// Unless required by applicable law or agreed to in writing, this software
+// is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.
+
+// Integer formatting benchmark: compares the integer overloads of jkj::dragonbox::to_chars_n
+// against std::to_chars. Each value is written into one big text buffer followed by a delimiter,
+// and the average time per value is reported for several input profiles.
+//
+// Usage: integer_benchmark [--count N] [--repeat R]
+
+#include "dragonbox/dragonbox_to_chars.h"
+#include "random_float.h"
+
+#include <algorithm>
+#include <charconv>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <limits>
+#include <string_view>
+#include <vector>
+
+template <class Int>
+static char* dragonbox_formatter(Int const* first, Int const* last, char* buffer) {
+    for (; first != last; ++first) {
+        buffer = jkj::dragonbox::to_chars_n(*first, buffer);
+        *buffer++ = '\n';
+    }
+    return buffer;
+}
+
+template <class Int>
+static char* std_to_chars_formatter(Int const* first, Int const* last, char* buffer) {
+    for (; first != last; ++first) {
+        buffer = std::to_chars(buffer, buffer + std::numeric_limits<Int>::digits10 + 2, *first).ptr;
+        *buffer++ = '\n';
+    }
+    return buffer;
+}
+
+template <class Int>
+static void run(std::string_view profile_name, std::vector<Int> const& samples,
+                std::size_t number_of_repetitions) {
+    using formatter = char* (*)(Int const*, Int const*, char*);
+    struct name_func_pair {
+        std::string_view name;
+        formatter func;
+    };
+    name_func_pair const name_func_pairs[] = {{"Dragonbox", dragonbox_formatter<Int>},
+                                              {"std::to_chars", std_to_chars_formatter<Int>}};
+
+    std::vector<char> buffer(samples.size() * (std::numeric_limits<Int>::digits10 + 3));
+    std::cout << profile_name << ":\n";
+    for (auto const& p : name_func_pairs) {
+        auto best = std::numeric_limits<double>::infinity();
+        std::size_t output_bytes = 0;
+        for (std::size_t i = 0; i < number_of_repetitions; ++i) {
+            auto from = std::chrono::steady_clock::now();
+            auto ptr = p.func(samples.data(), samples.data() + samples.size(), buffer.data());
+            auto dur = std::chrono::steady_clock::now() - from;
+            best = std::min(best, std::chrono::duration<double>(dur).count());
+            output_bytes = std::size_t(ptr - buffer.data());
+        }
+        std::cout << "  " << std::left << std::setw(16) << p.name << std::right << std::fixed
+                  << std::setprecision(2) << std::setw(8) << best * 1e9 / double(samples.size())
+                  << " ns/value, " << std::setw(8) << double(output_bytes) / best / 1e6
+                  << " MB/s\n";
+    }
+}
+
+// Uniformly random bit patterns; almost all of them have the maximum number of digits.
+template <class Int>
+static std::vector<Int> generate_uniform(std::size_t number_of_samples) {
+    auto rg = generate_correctly_seeded_mt19937_64();
+    std::vector<Int> samples(number_of_samples);
+    for (auto& x : samples) {
+        x = Int(rg());
+    }
+    return samples;
+}
+
+// The number of decimal digits is uniformly distributed, which makes the branches unpredictable.
+template <class Int>
+static std::vector<Int> generate_mixed_length(std::size_t number_of_samples) {
+    auto rg = generate_correctly_seeded_mt19937_64();
+    constexpr int max_digits = std::numeric_limits<Int>::digits10;
+    std::vector<Int> samples(number_of_samples);
+    for (auto& x : samples) {
+        auto const digits = int(rg() % max_digits) + 1;
+        std::uint_least64_t upper = 1;
+        for (int i = 0; i < digits; ++i) {
+            upper *= 10;
+        }
+        x = Int(rg() % upper);
+    }
+    return samples;
+}
+
+int main(int argc, char** argv) {
+    std::size_t number_of_samples = 10000000;
+    std::size_t number_of_repetitions = 5;
+
+    for (int i = 1; i < argc; ++i) {
+        std::string_view arg = argv[i];
+        if (arg == "--count" && i + 1 < argc) {
+            number_of_samples = std::strtoull(argv[++i], nullptr, 10);
+        }
+        else if (arg == "--repeat" && i + 1 < argc) {
+            number_of_repetitions = std::strtoull(argv[++i], nullptr, 10);
+        }
+        else {
+            std::cerr << "Usage: " << argv[0] << " [--count N] [--repeat R]\n";
+            return -1;
+        }
+    }
+
+    run("uint32, uniform", generate_uniform<std::uint32_t>(number_of_samples),
+        number_of_repetitions);
+    run("uint32, mixed length", generate_mixed_length<std::uint32_t>(number_of_samples),
+        number_of_repetitions);
+    run("uint64, uniform", generate_uniform<std::uint64_t>(number_of_samples),
+        number_of_repetitions);
+    run("uint64, mixed length", generate_mixed_length<std::uint64_t>(number_of_samples),
+        number_of_repetitions);
+    run("int64, mixed length", generate_mixed_length<std::int64_t>(number_of_samples),
+        number_of_repetitions);
+}
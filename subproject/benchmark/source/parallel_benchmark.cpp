@@ -0,0 +1,133 @@
+// Copyright 2025 Junekey Jeon
+//
+// The contents of this file may be used under the terms of
+// the Apache License v2.0 with LLVM Exceptions.
+//
+//    (See accompanying file LICENSE-Apache or copy at
+//     https://llvm.org/foundation/relicensing/LICENSE.txt)
+//
+// Alternatively, the contents of this file may be used under the terms of
+// the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE-Boost or copy at
+//     https://www.boost.org/LICENSE_1_0.txt)
+//
+// Unless required by applicable law or agreed to in writing, this software
+// is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.
+
+// Parallel formatting benchmark: reports how jkj::dragonbox::parallel_to_chars_n scales with the
+// number of threads, from 1 up to --threads, doubling each time, against a plain loop of
+// jkj::dragonbox::to_chars_n on the calling thread. Each value is written into one big text
+// buffer followed by a delimiter.
+//
+// Usage: parallel_benchmark [--count N] [--threads T] [--repeat R]
+
+#include "dragonbox/dragonbox_to_chars.h"
+#include "random_float.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <limits>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+template <class Func>
+static double best_time(Func const& func, std::size_t number_of_repetitions) {
+    auto best = std::numeric_limits<double>::infinity();
+    for (std::size_t i = 0; i < number_of_repetitions; ++i) {
+        auto from = std::chrono::steady_clock::now();
+        func();
+        auto dur = std::chrono::steady_clock::now() - from;
+        best = std::min(best, std::chrono::duration<double>(dur).count());
+    }
+    return best;
+}
+
+template <class Float>
+static void run(std::string_view profile_name, std::vector<Float> const& samples,
+                unsigned int max_thread_count, std::size_t number_of_repetitions) {
+    constexpr auto max_length = jkj::dragonbox::max_output_string_length<
+        typename jkj::dragonbox::default_float_bit_carrier_conversion_traits<Float>::format>;
+    std::vector<char> buffer(samples.size() * (max_length + 1));
+    auto const input_bytes = double(samples.size() * sizeof(Float));
+
+    std::cout << profile_name << ":\n";
+    auto const serial = best_time(
+        [&] {
+            auto ptr = buffer.data();
+            for (auto x : samples) {
+                ptr = jkj::dragonbox::to_chars_n(x, ptr);
+                *ptr++ = '\n';
+            }
+        },
+        number_of_repetitions);
+    std::cout << "  " << std::left << std::setw(20) << "to_chars_n loop" << std::right
+              << std::fixed << std::setprecision(3) << std::setw(8) << input_bytes / serial / 1e9
+              << " GB/s in\n";
+
+    for (unsigned int thread_count = 1;;
+         thread_count = std::min(thread_count * 2, max_thread_count)) {
+        auto const parallel = best_time(
+            [&] {
+                jkj::dragonbox::parallel_to_chars_n(samples.data(), samples.data() + samples.size(),
+                                                    buffer.data(), '\n', thread_count);
+            },
+            number_of_repetitions);
+        std::cout << "  " << std::left << std::setw(20)
+                  << ("parallel, " + std::to_string(thread_count) + " threads") << std::right
+                  << std::fixed << std::setprecision(3) << std::setw(8)
+                  << input_bytes / parallel / 1e9 << " GB/s in, " << std::setprecision(2)
+                  << std::setw(6) << serial / parallel << "x\n";
+        if (thread_count == max_thread_count) {
+            break;
+        }
+    }
+}
+
+// Uniformly random bit patterns; almost all of them have the maximum number of digits.
+template <class Float>
+static std::vector<Float> generate_uniform(std::size_t number_of_samples) {
+    auto rg = generate_correctly_seeded_mt19937_64();
+    std::vector<Float> samples(number_of_samples);
+    for (auto& x : samples) {
+        x = uniformly_randomly_generate_finite_float<Float>(rg);
+    }
+    return samples;
+}
+
+int main(int argc, char** argv) {
+    std::size_t number_of_samples = 100000000;
+    unsigned int max_thread_count = std::max(1u, std::thread::hardware_concurrency());
+    std::size_t number_of_repetitions = 5;
+
+    for (int i = 1; i < argc; ++i) {
+        std::string_view arg = argv[i];
+        if (arg == "--count" && i + 1 < argc) {
+            number_of_samples = std::strtoull(argv[++i], nullptr, 10);
+        }
+        else if (arg == "--threads" && i + 1 < argc) {
+            max_thread_count = unsigned(std::strtoul(argv[++i], nullptr, 10));
+        }
+        else if (arg == "--repeat" && i + 1 < argc) {
+            number_of_repetitions = std::strtoull(argv[++i], nullptr, 10);
+        }
+        else {
+            std::cerr << "Usage: " << argv[0] << " [--count N] [--threads T] [--repeat R]\n";
+            return -1;
+        }
+    }
+    if (number_of_samples == 0 || number_of_repetitions == 0 || max_thread_count == 0) {
+        std::cerr << "--count, --threads and --repeat must be positive.\n";
+        return -1;
+    }
+
+    run("binary32, uniform", generate_uniform<float>(number_of_samples), max_thread_count,
+        number_of_repetitions);
+    run("binary64, uniform", generate_uniform<double>(number_of_samples), max_thread_count,
+        number_of_repetitions);
+}
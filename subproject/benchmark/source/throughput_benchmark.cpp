@@ -0,0 +1,376 @@
+// Copyright 2025 Junekey Jeon
+//
+// The contents of this file may be used under the terms of
+// the Apache License v2.0 with LLVM Exceptions.
+//
+//    (See accompanying file LICENSE-Apache or copy at
+//     https://llvm.org/foundation/relicensing/LICENSE.txt)
+//
+// Alternatively, the contents of this file may be used under the terms of
+// the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE-Boost or copy at
+//     https://www.boost.org/LICENSE_1_0.txt)
+//
+// Unless required by applicable law or agreed to in writing, this software
+// is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.
+
+// End-to-end serialization benchmark: formats a large array of floating-point numbers into one big
+// text buffer, each value followed by a delimiter, and reports the throughput in terms of both
+// the input and the output bytes, together with the average number of output bytes per value.
+//
+// Usage: throughput_benchmark [--count N] [--threads T] [--repeat R] [--file PATH --type f32|f64]
+//
+// Without --file, the input is taken from the profiles of random_float.h. With --file, the given
+// file is mapped into memory and interpreted as a native-endian array of float's or double's.
+
+#include "throughput_benchmark.h"
+#include "random_float.h"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <limits>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#if defined(__unix__) || defined(__APPLE__)
+    #include <fcntl.h>
+    #include <sys/mman.h>
+    #include <sys/stat.h>
+    #include <unistd.h>
+    #define JKJ_THROUGHPUT_BENCHMARK_HAS_MMAP 1
+#else
+    #define JKJ_THROUGHPUT_BENCHMARK_HAS_MMAP 0
+#endif
+
+template <class Float>
+class throughput_benchmark_holder {
+public:
+    static throughput_benchmark_holder& get_instance() {
+        static throughput_benchmark_holder<Float> inst;
+        return inst;
+    }
+
+    void register_function(std::string_view name, array_formatter<Float> func) {
+        name_func_pairs_.emplace_back(name, func);
+    }
+
+    struct result {
+        double seconds;
+        std::size_t output_bytes;
+    };
+
+    // Runs func over the samples split into thread_count contiguous slices and returns the best
+    // wall-clock time among number_of_repetitions runs. Each thread writes into its own part of
+    // the buffer, and the parts are then moved next to each other, so that the output is always a
+    // single contiguous text as with thread_count == 1. The moves are included in the time.
+    static result run_one(array_formatter<Float> func, Float const* samples,
+                          std::size_t number_of_samples, char* buffer, char delimiter,
+                          unsigned int thread_count, std::size_t number_of_repetitions) {
+        std::vector<std::size_t> written(thread_count);
+        auto slice = [&](unsigned int idx) {
+            return std::pair<std::size_t, std::size_t>{number_of_samples * idx / thread_count,
+                                                       number_of_samples * (idx + 1) /
+                                                           thread_count};
+        };
+        auto work = [&](unsigned int idx) {
+            auto [from, to] = slice(idx);
+            auto const out = buffer + from * max_bytes_per_value;
+            written[idx] = std::size_t(func(samples + from, samples + to, out, delimiter) - out);
+        };
+
+        double best = std::numeric_limits<double>::infinity();
+        for (std::size_t rep = 0; rep < number_of_repetitions; ++rep) {
+            auto from = std::chrono::steady_clock::now();
+            if (thread_count == 1) {
+                work(0);
+            }
+            else {
+                std::vector<std::thread> threads;
+                threads.reserve(thread_count);
+                for (unsigned int idx = 0; idx < thread_count; ++idx) {
+                    threads.emplace_back(work, idx);
+                }
+                for (auto& t : threads) {
+                    t.join();
+                }
+                auto end = buffer + written[0];
+                for (unsigned int idx = 1; idx < thread_count; ++idx) {
+                    std::memmove(end, buffer + slice(idx).first * max_bytes_per_value,
+                                 written[idx]);
+                    end += written[idx];
+                }
+            }
+            auto dur = std::chrono::steady_clock::now() - from;
+            best = std::min(best, std::chrono::duration<double>(dur).count());
+        }
+
+        std::size_t output_bytes = 0;
+        for (auto w : written) {
+            output_bytes += w;
+        }
+        return {best, output_bytes};
+    }
+
+    void run(std::string_view profile_name, Float const* samples, std::size_t number_of_samples,
+             std::vector<unsigned int> const& thread_counts, std::size_t number_of_repetitions) {
+        auto buffer = std::make_unique<char[]>(number_of_samples * max_bytes_per_value);
+        auto const input_bytes = double(number_of_samples * sizeof(Float));
+
+        std::cout << "\n[" << profile_name << ", " << number_of_samples << " values]\n";
+        std::cout << std::left << std::setw(24) << "name" << std::right << std::setw(9)
+                  << "threads" << std::setw(12) << "in GB/s" << std::setw(12) << "out GB/s"
+                  << std::setw(12) << "bytes/val" << std::setw(12) << "ns/val" << "\n";
+
+        for (auto const& name_func_pair : name_func_pairs_) {
+            for (auto thread_count : thread_counts) {
+                auto r = run_one(name_func_pair.second, samples, number_of_samples, buffer.get(),
+                                 '\n', thread_count, number_of_repetitions);
+                std::cout << std::left << std::setw(24) << name_func_pair.first << std::right
+                          << std::setw(9) << thread_count << std::fixed << std::setprecision(3)
+                          << std::setw(12) << input_bytes / r.seconds / 1e9 << std::setw(12)
+                          << double(r.output_bytes) / r.seconds / 1e9 << std::setw(12)
+                          << double(r.output_bytes) / double(number_of_samples) << std::setw(12)
+                          << r.seconds * 1e9 / double(number_of_samples) << "\n"
+                          << std::defaultfloat;
+            }
+        }
+    }
+
+    bool empty() const noexcept { return name_func_pairs_.empty(); }
+
+private:
+    throughput_benchmark_holder() = default;
+
+    std::vector<std::pair<std::string, array_formatter<Float>>> name_func_pairs_;
+};
+
+register_function_for_throughput_benchmark::register_function_for_throughput_benchmark(
+    std::string_view name, array_formatter<float> func_float) {
+    throughput_benchmark_holder<float>::get_instance().register_function(name, func_float);
+}
+
+register_function_for_throughput_benchmark::register_function_for_throughput_benchmark(
+    std::string_view name, array_formatter<double> func_double) {
+    throughput_benchmark_holder<double>::get_instance().register_function(name, func_double);
+}
+
+register_function_for_throughput_benchmark::register_function_for_throughput_benchmark(
+    std::string_view name, array_formatter<float> func_float, array_formatter<double> func_double) {
+    throughput_benchmark_holder<float>::get_instance().register_function(name, func_float);
+    throughput_benchmark_holder<double>::get_instance().register_function(name, func_double);
+}
+
+// Read-only view of a file's contents, mapped into memory when possible.
+class mapped_file {
+public:
+    explicit mapped_file(char const* path) {
+#if JKJ_THROUGHPUT_BENCHMARK_HAS_MMAP
+        int fd = ::open(path, O_RDONLY);
+        if (fd < 0) {
+            return;
+        }
+        struct stat st;
+        if (::fstat(fd, &st) == 0 && st.st_size > 0) {
+            auto ptr = ::mmap(nullptr, std::size_t(st.st_size), PROT_READ, MAP_PRIVATE, fd, 0);
+            if (ptr != MAP_FAILED) {
+                data_ = static_cast<char const*>(ptr);
+                size_ = std::size_t(st.st_size);
+                mapped_ = true;
+            }
+        }
+        ::close(fd);
+        if (mapped_) {
+            return;
+        }
+#endif
+        std::ifstream in{path, std::ios::binary};
+        if (in) {
+            storage_.assign(std::istreambuf_iterator<char>{in}, std::istreambuf_iterator<char>{});
+            data_ = storage_.data();
+            size_ = storage_.size();
+        }
+    }
+
+    mapped_file(mapped_file const&) = delete;
+    mapped_file& operator=(mapped_file const&) = delete;
+
+    ~mapped_file() {
+#if JKJ_THROUGHPUT_BENCHMARK_HAS_MMAP
+        if (mapped_) {
+            ::munmap(const_cast<char*>(data_), size_);
+        }
+#endif
+    }
+
+    char const* data() const noexcept { return data_; }
+    std::size_t size() const noexcept { return size_; }
+
+private:
+    char const* data_ = nullptr;
+    std::size_t size_ = 0;
+    bool mapped_ = false;
+    std::vector<char> storage_;
+};
+
+template <class Float>
+static void benchmark_file(mapped_file const& file, std::vector<unsigned int> const& thread_counts,
+                           std::size_t number_of_repetitions) {
+    auto& inst = throughput_benchmark_holder<Float>::get_instance();
+    // The mapping may not be suitably aligned for Float when the file is read into a vector.
+    std::vector<Float> samples(file.size() / sizeof(Float));
+    if (samples.empty()) {
+        std::cout << "The file contains no values.\n";
+        return;
+    }
+    std::memcpy(samples.data(), file.data(), samples.size() * sizeof(Float));
+    inst.run("file", samples.data(), samples.size(), thread_counts, number_of_repetitions);
+}
+
+template <class Float>
+static void benchmark_profiles(std::string_view float_name, std::size_t number_of_samples,
+                               std::vector<unsigned int> const& thread_counts,
+                               std::size_t number_of_repetitions) {
+    auto& inst = throughput_benchmark_holder<Float>::get_instance();
+    if (inst.empty()) {
+        return;
+    }
+    std::cout << "\n[Running throughput benchmark for " << float_name << "...]\n";
+
+    auto rg = generate_correctly_seeded_mt19937_64();
+    std::vector<Float> samples(number_of_samples);
+
+    std::cout << "Generating random samples...\n";
+    for (auto& sample : samples) {
+        sample = uniformly_randomly_generate_finite_float<Float>(rg);
+    }
+    inst.run("uniformly random finite", samples.data(), samples.size(), thread_counts,
+             number_of_repetitions);
+
+    constexpr auto max_digits = unsigned(std::numeric_limits<Float>::max_digits10);
+    for (unsigned int digits : {3u, 6u, max_digits - 1}) {
+        for (auto& sample : samples) {
+            sample = randomly_generate_float_with_given_digits<Float>(digits, rg);
+        }
+        inst.run(std::to_string(digits) + " digits", samples.data(), samples.size(),
+                 thread_counts, number_of_repetitions);
+    }
+
+    // The number of digits is uniformly distributed, which makes the branches in the algorithm
+    // unpredictable.
+    for (auto& sample : samples) {
+        sample = randomly_generate_float_with_given_digits<Float>(
+            unsigned(rg() % max_digits) + 1, rg);
+    }
+    inst.run("1 to " + std::to_string(max_digits) + " digits", samples.data(), samples.size(),
+             thread_counts, number_of_repetitions);
+
+    // Powers of two, such as buffer sizes and scale factors, are all in the shorter interval case.
+    for (auto& sample : samples) {
+        sample = std::ldexp(Float(1), int(rg() % 97) - 32);
+    }
+    inst.run("powers of two", samples.data(), samples.size(), thread_counts,
+             number_of_repetitions);
+
+    // Integers of random bit lengths, such as counts and IDs, all exactly representable.
+    constexpr int precision = std::numeric_limits<Float>::digits;
+    for (auto& sample : samples) {
+        sample = Float((rg() >> (64 - precision)) >> (rg() % precision));
+    }
+    inst.run("integers", samples.data(), samples.size(), thread_counts, number_of_repetitions);
+
+    // Prices with two fractional digits below 100000, as in financial feeds.
+    for (auto& sample : samples) {
+        sample = Float(rg() % 10000000) / Float(100);
+    }
+    inst.run("prices", samples.data(), samples.size(), thread_counts, number_of_repetitions);
+
+    // A few values, such as 0, 1, 0.5 and thresholds, repeated among random values, as in metrics.
+    Float const repeated_values[] = {Float(0),   Float(1),    Float(0.5),  Float(0.25),
+                                     Float(0.9), Float(0.95), Float(0.99), Float(100),
+                                     Float(-1),  Float(1e-3), Float(1e3),  Float(60)};
+    for (unsigned int repeat_percentage : {50u, 90u, 99u}) {
+        for (auto& sample : samples) {
+            sample = rg() % 100 < repeat_percentage
+                         ? repeated_values[rg() % (sizeof(repeated_values) / sizeof(Float))]
+                         : uniformly_randomly_generate_finite_float<Float>(rg);
+        }
+        inst.run(std::to_string(repeat_percentage) + "% repeated values", samples.data(),
+                 samples.size(), thread_counts, number_of_repetitions);
+    }
+}
+
+int main(int argc, char** argv) {
+    std::size_t number_of_samples = 10000000;
+    std::size_t number_of_repetitions = 5;
+    unsigned int max_thread_count = std::max(1u, std::thread::hardware_concurrency());
+    char const* file_path = nullptr;
+    std::string_view file_type = "f64";
+
+    for (int i = 1; i < argc; ++i) {
+        std::string_view arg = argv[i];
+        if (i + 1 == argc) {
+            std::cerr << "Missing value for " << arg << "\n";
+            return -1;
+        }
+        if (arg == "--count") {
+            number_of_samples = std::strtoull(argv[++i], nullptr, 10);
+        }
+        else if (arg == "--threads") {
+            max_thread_count = unsigned(std::strtoul(argv[++i], nullptr, 10));
+        }
+        else if (arg == "--repeat") {
+            number_of_repetitions = std::strtoull(argv[++i], nullptr, 10);
+        }
+        else if (arg == "--file") {
+            file_path = argv[++i];
+        }
+        else if (arg == "--type") {
+            file_type = argv[++i];
+        }
+        else {
+            std::cerr << "Unknown option " << arg << "\n";
+            return -1;
+        }
+    }
+    if (number_of_samples == 0 || number_of_repetitions == 0 || max_thread_count == 0) {
+        std::cerr << "--count, --threads and --repeat must be positive.\n";
+        return -1;
+    }
+
+    std::vector<unsigned int> thread_counts{1};
+    if (max_thread_count > 1) {
+        thread_counts.push_back(max_thread_count);
+    }
+
+    if (file_path) {
+        mapped_file file{file_path};
+        if (!file.data()) {
+            std::cerr << "Failed to read " << file_path << "\n";
+            return -1;
+        }
+        if (file_type == "f32") {
+            benchmark_file<float>(file, thread_counts, number_of_repetitions);
+        }
+        else if (file_type == "f64") {
+            benchmark_file<double>(file, thread_counts, number_of_repetitions);
+        }
+        else {
+            std::cerr << "--type must be either f32 or f64.\n";
+            return -1;
+        }
+        return 0;
+    }
+
+    benchmark_profiles<float>("binary32", number_of_samples, thread_counts, number_of_repetitions);
+    benchmark_profiles<double>("binary64", number_of_samples, thread_counts, number_of_repetitions);
+}
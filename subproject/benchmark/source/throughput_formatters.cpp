@@ -0,0 +1,252 @@
+// Copyright 2025 Junekey Jeon
+//
+// The contents of this file may be used under the terms of
+// the Apache License v2.0 with LLVM Exceptions.
+//
+//    (See accompanying file LICENSE-Apache or copy at
+//     https://llvm.org/foundation/relicensing/LICENSE.txt)
+//
+// Alternatively, the contents of this file may be used under the terms of
+// the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE-Boost or copy at
+//     https://www.boost.org/LICENSE_1_0.txt)
+//
+// Unless required by applicable law or agreed to in writing, this software
+// is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.
+
+#include "throughput_benchmark.h"
+#include "dragonbox/dragonbox_to_chars.h"
+#include <charconv>
+#include <cstdio>
+
+namespace {
+    template <class Float>
+    char* dragonbox_format_array(Float const* first, Float const* last, char* buffer,
+                                 char delimiter) {
+        for (; first != last; ++first) {
+            buffer = jkj::dragonbox::to_chars_n(*first, buffer);
+            *buffer++ = delimiter;
+        }
+        return buffer;
+    }
+
+    template <class Float>
+    char* dragonbox_shorter_interval_table_format_array(Float const* first, Float const* last,
+                                                        char* buffer, char delimiter) {
+        for (; first != last; ++first) {
+            buffer = jkj::dragonbox::to_chars_n(
+                *first, buffer, jkj::dragonbox::policy::cache::with_shorter_interval_table);
+            *buffer++ = delimiter;
+        }
+        return buffer;
+    }
+
+    template <class Float>
+    char* dragonbox_branchless_format_array(Float const* first, Float const* last, char* buffer,
+                                            char delimiter) {
+        for (; first != last; ++first) {
+            buffer = jkj::dragonbox::to_chars_n(*first, buffer,
+                                                jkj::dragonbox::policy::branching::branchless);
+            *buffer++ = delimiter;
+        }
+        return buffer;
+    }
+
+    template <class Float>
+    char* dragonbox_integer_fast_path_format_array(Float const* first, Float const* last,
+                                                   char* buffer, char delimiter) {
+        for (; first != last; ++first) {
+            buffer = jkj::dragonbox::to_chars_n(*first, buffer,
+                                                jkj::dragonbox::policy::integer_fast_path::enabled);
+            *buffer++ = delimiter;
+        }
+        return buffer;
+    }
+
+    template <class Float>
+    char* dragonbox_short_decimal_format_array(Float const* first, Float const* last, char* buffer,
+                                               char delimiter) {
+        for (; first != last; ++first) {
+            buffer = jkj::dragonbox::to_chars_n(
+                *first, buffer, jkj::dragonbox::policy::digit_generation::short_decimal_first);
+            *buffer++ = delimiter;
+        }
+        return buffer;
+    }
+
+    template <class Float>
+    char* dragonbox_memoizing_format_array(Float const* first, Float const* last, char* buffer,
+                                           char delimiter) {
+        for (; first != last; ++first) {
+            buffer = jkj::dragonbox::memoizing_to_chars_n(*first, buffer);
+            *buffer++ = delimiter;
+        }
+        return buffer;
+    }
+
+    // The non-template entry point taking the rounding modes at runtime, with the default modes.
+    template <class Float>
+    char* dragonbox_runtime_policy_format_array(Float const* first, Float const* last, char* buffer,
+                                                char delimiter) {
+        jkj::dragonbox::runtime::policies const policies{};
+        for (; first != last; ++first) {
+            buffer = jkj::dragonbox::runtime::to_chars_n(*first, buffer, policies);
+            *buffer++ = delimiter;
+        }
+        return buffer;
+    }
+
+    template <class Float>
+    char* snprintf_format_array(Float const* first, Float const* last, char* buffer,
+                                char delimiter) {
+        // %.9g/%.17g always round-trips, but unlike the others it is not the shortest output.
+        constexpr int precision = sizeof(Float) == 4 ? 9 : 17;
+        for (; first != last; ++first) {
+            buffer += std::snprintf(buffer, max_bytes_per_value, "%.*g", precision, double(*first));
+            *buffer++ = delimiter;
+        }
+        return buffer;
+    }
+
+#if defined(__cpp_lib_to_chars) && __cpp_lib_to_chars >= 201611L
+    template <class Float>
+    char* std_to_chars_format_array(Float const* first, Float const* last, char* buffer,
+                                    char delimiter) {
+        for (; first != last; ++first) {
+            buffer = std::to_chars(buffer, buffer + max_bytes_per_value, *first).ptr;
+            *buffer++ = delimiter;
+        }
+        return buffer;
+    }
+#endif
+
+#ifdef JKJ_DRAGONBOX_TO_CHARS_ISA_DISPATCH
+    // Calls the copy of to_chars_n compiled for the given instruction set level directly,
+    // bypassing the dispatch.
+    template <class Float, jkj::dragonbox::detail::isa_level level>
+    char* dragonbox_isa_variant_format_array(Float const* first, Float const* last, char* buffer,
+                                             char delimiter) {
+        using conversion_traits = jkj::dragonbox::default_float_bit_carrier_conversion_traits<Float>;
+        auto const func = jkj::dragonbox::detail::get_isa_variant<
+            typename conversion_traits::format, typename conversion_traits::carrier_uint>(level);
+        for (; first != last; ++first) {
+            buffer = func(conversion_traits::float_to_carrier(*first), buffer);
+            *buffer++ = delimiter;
+        }
+        return buffer;
+    }
+
+    template <jkj::dragonbox::detail::isa_level level>
+    register_function_for_throughput_benchmark register_isa_variant(std::string_view name) {
+        using jkj::dragonbox::ieee754_binary64;
+        if (jkj::dragonbox::detail::get_isa_variant<ieee754_binary64, std::uint_least64_t>(level)) {
+            return {name, dragonbox_isa_variant_format_array<float, level>,
+                    dragonbox_isa_variant_format_array<double, level>};
+        }
+        return {};
+    }
+
+    auto dummy_dragonbox_baseline = register_isa_variant<jkj::dragonbox::detail::isa_level::baseline>(
+        "Dragonbox (baseline)");
+    auto dummy_dragonbox_x86_64_v2 =
+        register_isa_variant<jkj::dragonbox::detail::isa_level::x86_64_v2>("Dragonbox (x86-64-v2)");
+    auto dummy_dragonbox_x86_64_v3 =
+        register_isa_variant<jkj::dragonbox::detail::isa_level::x86_64_v3>("Dragonbox (x86-64-v3)");
+    auto dummy_dragonbox_x86_64_v4 =
+        register_isa_variant<jkj::dragonbox::detail::isa_level::x86_64_v4>("Dragonbox (x86-64-v4)");
+#endif
+
+#ifdef JKJ_DRAGONBOX_TO_CHARS_PGO_USE
+    // Compares the baseline copies of to_chars_n compiled with and without the profile, both called
+    // directly through a function pointer.
+    template <class Float, bool with_profile>
+    char* dragonbox_pgo_format_array(Float const* first, Float const* last, char* buffer,
+                                     char delimiter) {
+        using conversion_traits = jkj::dragonbox::default_float_bit_carrier_conversion_traits<Float>;
+        using format = typename conversion_traits::format;
+        using carrier_uint = typename conversion_traits::carrier_uint;
+        auto const func =
+            with_profile
+                ? jkj::dragonbox::detail::get_isa_variant<format, carrier_uint>(
+                      jkj::dragonbox::detail::isa_level::baseline)
+                : jkj::dragonbox::detail::get_variant_without_profile<format, carrier_uint>();
+        for (; first != last; ++first) {
+            buffer = func(conversion_traits::float_to_carrier(*first), buffer);
+            *buffer++ = delimiter;
+        }
+        return buffer;
+    }
+
+    auto dummy_dragonbox_with_profile = []() -> register_function_for_throughput_benchmark {
+        return {"Dragonbox (PGO)", dragonbox_pgo_format_array<float, true>,
+                dragonbox_pgo_format_array<double, true>};
+    }();
+    auto dummy_dragonbox_without_profile = []() -> register_function_for_throughput_benchmark {
+        return {"Dragonbox (no PGO)", dragonbox_pgo_format_array<float, false>,
+                dragonbox_pgo_format_array<double, false>};
+    }();
+#endif
+
+#if 1
+    auto dummy_dragonbox = []() -> register_function_for_throughput_benchmark {
+        return {"Dragonbox", dragonbox_format_array<float>, dragonbox_format_array<double>};
+    }();
+#endif
+
+#if 1
+    auto dummy_dragonbox_shorter_interval_table =
+        []() -> register_function_for_throughput_benchmark {
+        return {"Dragonbox (SI table)", dragonbox_shorter_interval_table_format_array<float>,
+                dragonbox_shorter_interval_table_format_array<double>};
+    }();
+#endif
+
+#if 1
+    auto dummy_dragonbox_branchless = []() -> register_function_for_throughput_benchmark {
+        return {"Dragonbox (branchless)", dragonbox_branchless_format_array<float>,
+                dragonbox_branchless_format_array<double>};
+    }();
+#endif
+
+#if 1
+    auto dummy_dragonbox_integer_fast_path = []() -> register_function_for_throughput_benchmark {
+        return {"Dragonbox (integers)", dragonbox_integer_fast_path_format_array<float>,
+                dragonbox_integer_fast_path_format_array<double>};
+    }();
+#endif
+
+#if 1
+    auto dummy_dragonbox_short_decimal = []() -> register_function_for_throughput_benchmark {
+        return {"Dragonbox (short first)", dragonbox_short_decimal_format_array<float>,
+                dragonbox_short_decimal_format_array<double>};
+    }();
+#endif
+
+#if 1
+    auto dummy_dragonbox_memoizing = []() -> register_function_for_throughput_benchmark {
+        return {"Dragonbox (memoizing)", dragonbox_memoizing_format_array<float>,
+                dragonbox_memoizing_format_array<double>};
+    }();
+#endif
+
+#if 1
+    auto dummy_dragonbox_runtime_policy = []() -> register_function_for_throughput_benchmark {
+        return {"Dragonbox (runtime)", dragonbox_runtime_policy_format_array<float>,
+                dragonbox_runtime_policy_format_array<double>};
+    }();
+#endif
+
+#if 1
+    auto dummy_snprintf = []() -> register_function_for_throughput_benchmark {
+        return {"snprintf", snprintf_format_array<float>, snprintf_format_array<double>};
+    }();
+#endif
+
+#if defined(__cpp_lib_to_chars) && __cpp_lib_to_chars >= 201611L
+    auto dummy_std_to_chars = []() -> register_function_for_throughput_benchmark {
+        return {"std::to_chars", std_to_chars_format_array<float>,
+                std_to_chars_format_array<double>};
+    }();
+#endif
+}
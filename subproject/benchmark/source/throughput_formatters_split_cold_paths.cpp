@@ -0,0 +1,47 @@
+// Copyright 2025 Junekey Jeon
+//
+// The contents of this file may be used under the terms of
+// the Apache License v2.0 with LLVM Exceptions.
+//
+//    (See accompanying file LICENSE-Apache or copy at
+//     https://llvm.org/foundation/relicensing/LICENSE.txt)
+//
+// Alternatively, the contents of this file may be used under the terms of
+// the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE-Boost or copy at
+//     https://www.boost.org/LICENSE_1_0.txt)
+//
+// Unless required by applicable law or agreed to in writing, this software
+// is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.
+
+// Same as the "Dragonbox (header-only)" entry in throughput_formatters_header_only.cpp, but with
+// the paths for rare inputs split into cold functions (JKJ_DRAGONBOX_SPLIT_COLD_PATHS), so that
+// the two can be compared in one run. A separate namespace keeps the two sets of definitions apart.
+
+#define JKJ_NAMESPACE jkj_dragonbox_split_cold_paths
+#define JKJ_DRAGONBOX_TO_CHARS_HEADER_ONLY 1
+#undef JKJ_DRAGONBOX_SPLIT_COLD_PATHS
+#define JKJ_DRAGONBOX_SPLIT_COLD_PATHS 1
+// The instances of the main algorithm in dragonbox_extern_templates live in the usual namespace.
+#undef JKJ_DRAGONBOX_EXTERN_TEMPLATES
+
+#include "throughput_benchmark.h"
+#include "dragonbox/dragonbox_to_chars.h"
+
+namespace {
+    template <class Float>
+    char* dragonbox_split_cold_paths_format_array(Float const* first, Float const* last,
+                                                  char* buffer, char delimiter) {
+        for (; first != last; ++first) {
+            buffer = jkj_dragonbox_split_cold_paths::dragonbox::to_chars_n(*first, buffer);
+            *buffer++ = delimiter;
+        }
+        return buffer;
+    }
+
+    auto dummy_dragonbox_split_cold_paths = []() -> register_function_for_throughput_benchmark {
+        return {"Dragonbox (cold split)", dragonbox_split_cold_paths_format_array<float>,
+                dragonbox_split_cold_paths_format_array<double>};
+    }();
+}
@@ -90,10 +90,10 @@ Float uniformly_randomly_generate_finite_float(RandGen& rg) {
 
     // Generate significand bits
     auto significand_bits =
-        uniform_distribution{0, (carrier_uint(1) << format_traits::significand_bits) - 1}(rg);
+        uniform_distribution{0, (carrier_uint(1) << format::significand_bits) - 1}(rg);
 
     auto bit_representation = (sign_bit << (format_traits::carrier_bits - 1)) |
-                              (exponent_bits << (format_traits::significand_bits)) | significand_bits;
+                              (exponent_bits << (format::significand_bits)) | significand_bits;
 
     return default_float_bit_carrier_conversion_traits::carrier_to_float(bit_representation);
 }
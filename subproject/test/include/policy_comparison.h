@@ -0,0 +1,52 @@
+// Copyright 2025 Junekey Jeon
+//
+// The contents of this file may be used under the terms of
+// the Apache License v2.0 with LLVM Exceptions.
+//
+//    (See accompanying file LICENSE-Apache or copy at
+//     https://llvm.org/foundation/relicensing/LICENSE.txt)
+//
+// Alternatively, the contents of this file may be used under the terms of
+// the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE-Boost or copy at
+//     https://www.boost.org/LICENSE_1_0.txt)
+//
+// Unless required by applicable law or agreed to in writing, this software
+// is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.
+
+#ifndef JKJ_HEADER_POLICY_COMPARISON
+#define JKJ_HEADER_POLICY_COMPARISON
+
+#include "dragonbox/dragonbox.h"
+
+// Compares all members of two decimal_fp's, including the optional ones.
+template <class SignificandType, class ExponentType, bool is_signed, bool trailing_zero_flag>
+bool is_identical(
+    jkj::dragonbox::decimal_fp<SignificandType, ExponentType, is_signed, trailing_zero_flag> x,
+    jkj::dragonbox::decimal_fp<SignificandType, ExponentType, is_signed, trailing_zero_flag> y) {
+    bool result = x.significand == y.significand && x.exponent == y.exponent;
+    if constexpr (is_signed) {
+        result &= x.is_negative == y.is_negative;
+    }
+    if constexpr (trailing_zero_flag) {
+        result &= x.may_have_trailing_zeros == y.may_have_trailing_zeros;
+    }
+    return result;
+}
+
+// Calls compare with the given decimal-to-binary rounding policy together with each of the
+// binary-to-decimal rounding policies, and returns whether all of the calls succeeded.
+template <class DecimalToBinaryRoundingPolicy, class Compare>
+bool compare_all_binary_to_decimal_rounding(Compare&& compare) {
+    namespace b2d = jkj::dragonbox::policy::binary_to_decimal_rounding;
+    bool success = true;
+    success &= compare(DecimalToBinaryRoundingPolicy{}, b2d::do_not_care);
+    success &= compare(DecimalToBinaryRoundingPolicy{}, b2d::to_even);
+    success &= compare(DecimalToBinaryRoundingPolicy{}, b2d::to_odd);
+    success &= compare(DecimalToBinaryRoundingPolicy{}, b2d::away_from_zero);
+    success &= compare(DecimalToBinaryRoundingPolicy{}, b2d::toward_zero);
+    return success;
+}
+
+#endif
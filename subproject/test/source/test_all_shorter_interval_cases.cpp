@@ -65,6 +65,61 @@ static bool test_all_shorter_interval_cases_impl(TestTarget&& test_target) {
     return success;
 }
 
+// Compares the results with and without the shorter interval table for inputs of both signs, for
+// the given rounding policies.
+template <class Float, class... Policies>
+static bool compare_with_shorter_interval_table(Policies... policies) {
+    using conversion_traits = jkj::dragonbox::default_float_bit_carrier_conversion_traits<Float>;
+    using ieee754_format_info = typename conversion_traits::format;
+    using carrier_uint = typename conversion_traits::carrier_uint;
+
+    bool success = true;
+    for (int e = ieee754_format_info::min_exponent; e <= ieee754_format_info::max_exponent; ++e) {
+        carrier_uint br = carrier_uint(e - ieee754_format_info::exponent_bias)
+                          << ieee754_format_info::significand_bits;
+        for (auto x : {conversion_traits::carrier_to_float(br),
+                       -conversion_traits::carrier_to_float(br)}) {
+            auto const expected = jkj::dragonbox::to_decimal(x, policies...);
+            auto const actual = jkj::dragonbox::to_decimal(
+                x, policies..., jkj::dragonbox::policy::cache::with_shorter_interval_table);
+            if (expected.significand != actual.significand ||
+                expected.exponent != actual.exponent ||
+                expected.is_negative != actual.is_negative) {
+                std::cout << "Error detected! [Expected = " << expected.significand << "E"
+                          << expected.exponent << ", Actual = " << actual.significand << "E"
+                          << actual.exponent << "]\n";
+                success = false;
+            }
+        }
+    }
+    return success;
+}
+
+template <class Float>
+static bool test_shorter_interval_table_rounding_modes() {
+    namespace d2b = jkj::dragonbox::policy::decimal_to_binary_rounding;
+    namespace b2d = jkj::dragonbox::policy::binary_to_decimal_rounding;
+    bool success = true;
+    success &= compare_with_shorter_interval_table<Float>(d2b::nearest_to_even, b2d::to_odd);
+    success &= compare_with_shorter_interval_table<Float>(d2b::nearest_to_odd, b2d::to_even);
+    success &= compare_with_shorter_interval_table<Float>(d2b::nearest_toward_plus_infinity,
+                                                          b2d::away_from_zero);
+    success &= compare_with_shorter_interval_table<Float>(d2b::nearest_toward_minus_infinity,
+                                                          b2d::toward_zero);
+    success &= compare_with_shorter_interval_table<Float>(d2b::nearest_toward_zero);
+    success &= compare_with_shorter_interval_table<Float>(d2b::nearest_away_from_zero);
+    success &= compare_with_shorter_interval_table<Float>(
+        jkj::dragonbox::policy::trailing_zero::ignore);
+
+    if (success) {
+        std::cout << "All cases are verified.\n";
+    }
+    else {
+        std::cout << "Error detected.\n";
+    }
+    return success;
+}
+
 int main() {
     bool success = true;
 
@@ -79,6 +134,29 @@ int main() {
     });
     std::cout << "Done.\n\n\n";
 
+    std::cout << "[Testing all shorter interval cases for binary32 (lazy full cache)...]\n";
+    success &= test_all_shorter_interval_cases_impl<float>([](auto x, char* buffer) {
+        jkj::dragonbox::to_chars(x, buffer, jkj::dragonbox::policy::cache::lazy_full);
+    });
+    std::cout << "Done.\n\n\n";
+
+    std::cout << "[Testing all shorter interval cases for binary32 (range cache)...]\n";
+    success &= test_all_shorter_interval_cases_impl<float>([](auto x, char* buffer) {
+        jkj::dragonbox::to_chars(x, buffer, jkj::dragonbox::policy::cache::range_t<-12, 12>{});
+    });
+    std::cout << "Done.\n\n\n";
+
+    std::cout << "[Testing all shorter interval cases for binary32 (shorter interval table)...]\n";
+    success &= test_all_shorter_interval_cases_impl<float>([](auto x, char* buffer) {
+        jkj::dragonbox::to_chars(x, buffer,
+                                 jkj::dragonbox::policy::cache::with_shorter_interval_table);
+    });
+    std::cout << "Done.\n\n\n";
+
+    std::cout << "[Testing the shorter interval table for binary32 with other rounding modes...]\n";
+    success &= test_shorter_interval_table_rounding_modes<float>();
+    std::cout << "Done.\n\n\n";
+
     std::cout << "[Testing all shorter interval cases for binary32 (simplified impl)...]\n";
     success &= test_all_shorter_interval_cases_impl<float>(
         [](auto x, char* buffer) { jkj::simple_dragonbox::to_chars(x, buffer); });
@@ -95,6 +173,29 @@ int main() {
     });
     std::cout << "Done.\n\n\n";
 
+    std::cout << "[Testing all shorter interval cases for binary64 (lazy full cache)...]\n";
+    success &= test_all_shorter_interval_cases_impl<double>([](auto x, char* buffer) {
+        jkj::dragonbox::to_chars(x, buffer, jkj::dragonbox::policy::cache::lazy_full);
+    });
+    std::cout << "Done.\n\n\n";
+
+    std::cout << "[Testing all shorter interval cases for binary64 (range cache)...]\n";
+    success &= test_all_shorter_interval_cases_impl<double>([](auto x, char* buffer) {
+        jkj::dragonbox::to_chars(x, buffer, jkj::dragonbox::policy::cache::range_t<-12, 12>{});
+    });
+    std::cout << "Done.\n\n\n";
+
+    std::cout << "[Testing all shorter interval cases for binary64 (shorter interval table)...]\n";
+    success &= test_all_shorter_interval_cases_impl<double>([](auto x, char* buffer) {
+        jkj::dragonbox::to_chars(x, buffer,
+                                 jkj::dragonbox::policy::cache::with_shorter_interval_table);
+    });
+    std::cout << "Done.\n\n\n";
+
+    std::cout << "[Testing the shorter interval table for binary64 with other rounding modes...]\n";
+    success &= test_shorter_interval_table_rounding_modes<double>();
+    std::cout << "Done.\n\n\n";
+
     std::cout << "[Testing all shorter interval cases for binary64 (simplified impl)...]\n";
     success &= test_all_shorter_interval_cases_impl<double>(
         [](auto x, char* buffer) { jkj::simple_dragonbox::to_chars(x, buffer); });
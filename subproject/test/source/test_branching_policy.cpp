@@ -0,0 +1,121 @@
+// Copyright 2025 Junekey Jeon
+//
+// The contents of this file may be used under the terms of
+// the Apache License v2.0 with LLVM Exceptions.
+//
+//    (See accompanying file LICENSE-Apache or copy at
+//     https://llvm.org/foundation/relicensing/LICENSE.txt)
+//
+// Alternatively, the contents of this file may be used under the terms of
+// the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE-Boost or copy at
+//     https://www.boost.org/LICENSE_1_0.txt)
+//
+// Unless required by applicable law or agreed to in writing, this software
+// is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.
+
+#include "dragonbox/dragonbox_to_chars.h"
+#include "policy_comparison.h"
+#include "random_float.h"
+
+#include <cmath>
+#include <cstring>
+#include <iostream>
+#include <string_view>
+#include <vector>
+
+namespace policy = jkj::dragonbox::policy;
+
+// Compares the branchless variant against the default one with the same other policies.
+template <class Float, class... Policies>
+static bool compare(Float x, Policies... policies) {
+    auto const expected = jkj::dragonbox::to_decimal(x, policies..., policy::branching::branchy);
+    auto const actual = jkj::dragonbox::to_decimal(x, policies..., policy::branching::branchless);
+    if (!is_identical(expected, actual)) {
+        char buffer[64];
+        jkj::dragonbox::to_chars(x, buffer);
+        std::cout << "Error detected in to_decimal! [Input = " << buffer << "]\n";
+        return false;
+    }
+    return true;
+}
+
+template <class Float>
+static bool compare_all(Float x) {
+    namespace d2b = policy::decimal_to_binary_rounding;
+    auto const compare_x = [x](auto... policies) { return compare(x, policies...); };
+    bool success = true;
+    success &= compare_all_binary_to_decimal_rounding<d2b::nearest_to_even_t>(compare_x);
+    success &= compare_all_binary_to_decimal_rounding<d2b::nearest_to_odd_t>(compare_x);
+    success &= compare_all_binary_to_decimal_rounding<d2b::nearest_toward_plus_infinity_t>(compare_x);
+    success &= compare_all_binary_to_decimal_rounding<d2b::nearest_toward_minus_infinity_t>(compare_x);
+    success &= compare_all_binary_to_decimal_rounding<d2b::nearest_toward_zero_t>(compare_x);
+    success &= compare_all_binary_to_decimal_rounding<d2b::nearest_away_from_zero_t>(compare_x);
+    success &=
+        compare_all_binary_to_decimal_rounding<d2b::nearest_to_even_static_boundary_t>(compare_x);
+    success &= compare(x, policy::trailing_zero::ignore);
+    success &= compare(x, policy::trailing_zero::report);
+    success &= compare(x, policy::trailing_zero::remove_compact);
+    success &= compare(x, policy::sign::ignore, policy::cache::compact);
+
+    char expected[64], actual[64];
+    jkj::dragonbox::to_chars(x, expected);
+    jkj::dragonbox::to_chars(x, actual, policy::branching::branchless);
+    if (std::strcmp(expected, actual) != 0) {
+        std::cout << "Error detected in to_chars! [Expected = " << expected
+                  << ", Branchless = " << actual << "]\n";
+        success = false;
+    }
+    return success;
+}
+
+template <class Float>
+static bool branching_policy_test(std::size_t number_of_tests, std::string_view type_name) {
+    using conversion_traits = jkj::dragonbox::default_float_bit_carrier_conversion_traits<Float>;
+    auto rg = generate_correctly_seeded_mt19937_64();
+    bool success = true;
+
+    // Uniformly random bit patterns mostly have the maximum number of digits. Inputs with few
+    // digits and integers exercise the larger divisor, the integer checks, and the ties.
+    std::vector<Float> samples;
+    for (std::size_t test_idx = 0; test_idx < number_of_tests; ++test_idx) {
+        samples.push_back(uniformly_randomly_generate_finite_float<Float>(rg));
+        samples.push_back(randomly_generate_float_with_given_digits<Float>(
+            unsigned(test_idx % conversion_traits::format::decimal_significand_digits) + 1, rg));
+        samples.push_back(std::ldexp(Float(test_idx + 1), int(test_idx % 128)));
+    }
+    for (auto x : samples) {
+        if (x == 0 || !std::isfinite(x)) {
+            continue;
+        }
+        if (!compare_all(x)) {
+            success = false;
+            break;
+        }
+    }
+
+    if (success) {
+        std::cout << "Branching policy test for " << type_name << " with " << samples.size()
+                  << " examples succeeded.\n";
+    }
+    return success;
+}
+
+int main() {
+    constexpr std::size_t number_of_tests = 100000;
+    bool success = true;
+
+    std::cout << "[Testing branching policies for binary32...]\n";
+    success &= branching_policy_test<float>(number_of_tests, "binary32");
+    std::cout << "Done.\n\n\n";
+
+    std::cout << "[Testing branching policies for binary64...]\n";
+    success &= branching_policy_test<double>(number_of_tests, "binary64");
+    std::cout << "Done.\n\n\n";
+
+    if (!success) {
+        std::cout << "Error detected.\n";
+        return -1;
+    }
+}
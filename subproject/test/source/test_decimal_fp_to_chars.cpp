@@ -0,0 +1,182 @@
+// Copyright 2025 Junekey Jeon
+//
+// The contents of this file may be used under the terms of
+// the Apache License v2.0 with LLVM Exceptions.
+//
+//    (See accompanying file LICENSE-Apache or copy at
+//     https://llvm.org/foundation/relicensing/LICENSE.txt)
+//
+// Alternatively, the contents of this file may be used under the terms of
+// the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE-Boost or copy at
+//     https://www.boost.org/LICENSE_1_0.txt)
+//
+// Unless required by applicable law or agreed to in writing, this software
+// is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.
+
+#include "dragonbox/dragonbox_to_chars.h"
+#include "random_float.h"
+
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <iostream>
+#include <limits>
+#include <string_view>
+#include <vector>
+
+namespace policy = jkj::dragonbox::policy;
+
+// Compares to_chars of the result of to_decimal with the given policies against to_chars of the
+// input with the same rounding policies. If the sign is ignored, against the absolute value.
+template <class Float, class RoundingPolicy, class... Policies>
+static bool compare(std::vector<Float> const& samples, RoundingPolicy rounding_policy,
+                    Policies... policies) {
+    for (auto const x : samples) {
+        auto const decimal = jkj::dragonbox::to_decimal(x, rounding_policy, policies...);
+        char buffer[64];
+        auto const end = jkj::dragonbox::to_chars_n(decimal, buffer);
+
+        char expected[64];
+        auto const is_signed = (sizeof...(Policies) == 0) ||
+                               !(std::is_same<Policies, policy::sign::ignore_t>::value || ...);
+        auto const expected_end =
+            jkj::dragonbox::to_chars_n(is_signed ? x : std::abs(x), expected, rounding_policy);
+
+        if (std::string_view(buffer, std::size_t(end - buffer)) !=
+            std::string_view(expected, std::size_t(expected_end - expected))) {
+            *end = '\0';
+            *expected_end = '\0';
+            std::cout << "Error detected! [Expected = " << expected << ", Actual = " << buffer
+                      << "]\n";
+            return false;
+        }
+    }
+    return true;
+}
+
+template <class Float>
+static bool compare_all(std::vector<Float> const& samples) {
+    namespace d2b = policy::decimal_to_binary_rounding;
+    namespace b2d = policy::binary_to_decimal_rounding;
+    bool success = true;
+    success &= compare(samples, d2b::nearest_to_even);
+    success &= compare(samples, d2b::nearest_to_even, policy::trailing_zero::ignore);
+    success &= compare(samples, d2b::nearest_to_even, policy::trailing_zero::report);
+    success &= compare(samples, d2b::nearest_to_even, policy::trailing_zero::remove_compact);
+    success &= compare(samples, d2b::nearest_to_even, policy::sign::ignore);
+    success &= compare(samples, d2b::nearest_to_even, policy::sign::ignore,
+                       policy::trailing_zero::report);
+    success &= compare(samples, d2b::nearest_to_odd, policy::trailing_zero::report);
+    success &= compare(samples, d2b::toward_zero, policy::trailing_zero::report);
+    success &= compare(samples, d2b::away_from_zero, policy::trailing_zero::ignore);
+    success &= compare(samples, b2d::away_from_zero, policy::trailing_zero::report);
+    success &= compare(samples, b2d::away_from_zero, policy::integer_fast_path::enabled,
+                       policy::trailing_zero::report);
+    return success;
+}
+
+template <class Float>
+static bool to_decimal_result_test(std::size_t number_of_tests, std::string_view type_name) {
+    auto rg = generate_correctly_seeded_mt19937_64();
+    using conversion_traits = jkj::dragonbox::default_float_bit_carrier_conversion_traits<Float>;
+
+    // Random finite nonzero inputs, inputs with few digits, integers with many trailing zeros, and
+    // subnormals.
+    std::vector<Float> samples;
+    for (std::size_t test_idx = 0; test_idx < number_of_tests; ++test_idx) {
+        Float x;
+        do {
+            x = uniformly_randomly_generate_finite_float<Float>(rg);
+        } while (x == 0);
+        samples.push_back(x);
+        x = randomly_generate_float_with_given_digits<Float>(
+            unsigned(test_idx % conversion_traits::format::decimal_significand_digits) + 1, rg);
+        if (x != 0) {
+            samples.push_back(x);
+        }
+        samples.push_back(Float(test_idx % 1000 + 1) * Float(test_idx % 2 == 0 ? 1000 : -1));
+    }
+    for (int e = std::numeric_limits<Float>::min_exponent10 - 1;
+         e <= std::numeric_limits<Float>::max_exponent10; ++e) {
+        samples.push_back(std::pow(Float(10), Float(e)));
+    }
+    samples.push_back(std::numeric_limits<Float>::denorm_min());
+    samples.push_back(std::numeric_limits<Float>::min());
+    samples.push_back(-std::numeric_limits<Float>::max());
+
+    bool success = compare_all(samples);
+    if (success) {
+        std::cout << "to_chars of to_decimal results for " << type_name << " with "
+                  << samples.size() << " examples succeeded.\n";
+    }
+    return success;
+}
+
+template <class DecimalFp>
+static bool check(DecimalFp v, char const* expected) {
+    char buffer[64];
+    jkj::dragonbox::to_chars(v, buffer);
+    if (std::strcmp(buffer, expected) != 0) {
+        std::cout << "Error detected! [Expected = " << expected << ", Actual = " << buffer << "]\n";
+        return false;
+    }
+    return true;
+}
+
+// Decimals that to_decimal does not produce, including ones of the maximum number of digits with
+// trailing zeros.
+static bool external_decimal_test() {
+    using jkj::dragonbox::signed_decimal_fp;
+    using jkj::dragonbox::unsigned_decimal_fp;
+    using u32 = std::uint_least32_t;
+    using u64 = std::uint_least64_t;
+
+    bool success = true;
+    success &= check(unsigned_decimal_fp<u32, int>{123, -2}, "1.23E0");
+    success &= check(signed_decimal_fp<u32, int>{5, 38, true}, "-5E38");
+    success &= check(unsigned_decimal_fp<u32, int, true>{1230000, -3, true}, "1.23E3");
+    success &= check(unsigned_decimal_fp<u32, int, true>{100000000, -45, true}, "1E-37");
+    success &= check(signed_decimal_fp<u32, short, true>{123456780, 0, true, false}, "1.2345678E8");
+    success &= check(signed_decimal_fp<u32, int, true>{123456789, 0, false, true}, "-1.23456789E8");
+    success &= check(unsigned_decimal_fp<u64, int>{17, 306}, "1.7E307");
+    success &= check(signed_decimal_fp<u64, int>{12345678901234567, -340, true},
+                     "-1.2345678901234567E-324");
+    success &= check(unsigned_decimal_fp<u64, int, true>{12345678901234500, 0, true},
+                     "1.23456789012345E16");
+    success &= check(signed_decimal_fp<u64, int, true>{10000000000000000, -16, true, true}, "-1E0");
+    success &= check(signed_decimal_fp<u64, int, true>{4200, 0, false, false}, "4.2E3");
+    // Significand types of the same width as the above but possibly of a different type.
+    success &= check(unsigned_decimal_fp<unsigned long long, int>{12345678901234567, 3},
+                     "1.2345678901234567E19");
+    success &= check(signed_decimal_fp<unsigned long long, int, true>{1200, -5, true, true},
+                     "-1.2E-2");
+    success &= check(unsigned_decimal_fp<std::uint32_t, int>{25, 1}, "2.5E2");
+    if (success) {
+        std::cout << "to_chars of external decimals succeeded.\n";
+    }
+    return success;
+}
+
+int main() {
+    constexpr std::size_t number_of_tests = 100000;
+    bool success = true;
+
+    std::cout << "[Testing to_chars of to_decimal results for binary32...]\n";
+    success &= to_decimal_result_test<float>(number_of_tests, "binary32");
+    std::cout << "Done.\n\n\n";
+
+    std::cout << "[Testing to_chars of to_decimal results for binary64...]\n";
+    success &= to_decimal_result_test<double>(number_of_tests, "binary64");
+    std::cout << "Done.\n\n\n";
+
+    std::cout << "[Testing to_chars of external decimals...]\n";
+    success &= external_decimal_test();
+    std::cout << "Done.\n\n\n";
+
+    if (!success) {
+        std::cout << "Error detected.\n";
+        return -1;
+    }
+}
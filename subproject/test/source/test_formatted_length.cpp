@@ -0,0 +1,165 @@
+// Copyright 2025 Junekey Jeon
+//
+// The contents of this file may be used under the terms of
+// the Apache License v2.0 with LLVM Exceptions.
+//
+//    (See accompanying file LICENSE-Apache or copy at
+//     https://llvm.org/foundation/relicensing/LICENSE.txt)
+//
+// Alternatively, the contents of this file may be used under the terms of
+// the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE-Boost or copy at
+//     https://www.boost.org/LICENSE_1_0.txt)
+//
+// Unless required by applicable law or agreed to in writing, this software
+// is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.
+
+#include "dragonbox/dragonbox_to_chars.h"
+#include "random_float.h"
+
+#include <cmath>
+#include <cstdint>
+#include <iostream>
+#include <limits>
+#include <string_view>
+#include <vector>
+
+namespace policy = jkj::dragonbox::policy;
+
+// Compares formatted_length and formatted_length_batch against the length of the output of
+// to_chars_n with the same policies.
+template <class Float, class... Policies>
+static bool compare(std::vector<Float> const& samples, Policies... policies) {
+    std::vector<std::size_t> lengths(samples.size());
+    auto const total_length = jkj::dragonbox::formatted_length_batch(
+        samples.data(), samples.data() + samples.size(), lengths.data(), policies...);
+
+    std::size_t expected_total_length = 0;
+    for (std::size_t idx = 0; idx < samples.size(); ++idx) {
+        char buffer[64];
+        auto const expected =
+            std::size_t(jkj::dragonbox::to_chars_n(samples[idx], buffer, policies...) - buffer);
+        expected_total_length += expected;
+        if (jkj::dragonbox::formatted_length(samples[idx], policies...) != expected ||
+            lengths[idx] != expected) {
+            jkj::dragonbox::to_chars(samples[idx], buffer, policies...);
+            std::cout << "Error detected! [Input = " << buffer << "]\n";
+            return false;
+        }
+    }
+    if (total_length != expected_total_length) {
+        std::cout << "Error detected! [Wrong total length]\n";
+        return false;
+    }
+    return true;
+}
+
+template <class Float>
+static bool compare_all(std::vector<Float> const& samples) {
+    namespace d2b = policy::decimal_to_binary_rounding;
+    namespace b2d = policy::binary_to_decimal_rounding;
+    bool success = true;
+    success &= compare(samples);
+    success &= compare(samples, d2b::nearest_to_odd);
+    success &= compare(samples, d2b::nearest_toward_minus_infinity);
+    success &= compare(samples, d2b::nearest_toward_plus_infinity_static_boundary);
+    success &= compare(samples, d2b::toward_plus_infinity);
+    success &= compare(samples, d2b::away_from_zero);
+    success &= compare(samples, b2d::away_from_zero);
+    success &= compare(samples, b2d::do_not_care);
+    success &= compare(samples, policy::cache::compact);
+    success &= compare(samples, policy::integer_fast_path::enabled);
+    success &= compare(samples, policy::digit_generation::compact);
+    return success;
+}
+
+static bool decimal_digit_count_test() {
+    // Around each power of 10 and each power of 2.
+    std::vector<std::uint_least64_t> samples;
+    std::uint_least64_t power_of_10 = 1;
+    for (int k = 0; k < 20; ++k, power_of_10 *= 10) {
+        samples.push_back(power_of_10);
+        samples.push_back(power_of_10 - 1);
+        samples.push_back(power_of_10 + 1);
+    }
+    for (int k = 0; k < 64; ++k) {
+        auto const power_of_2 = std::uint_least64_t(1) << k;
+        samples.push_back(power_of_2);
+        samples.push_back(power_of_2 - 1);
+        samples.push_back(power_of_2 + 1);
+    }
+    samples.push_back(std::numeric_limits<std::uint_least64_t>::max());
+
+    for (auto n : samples) {
+        if (n == 0) {
+            continue;
+        }
+        int expected = 1;
+        for (auto m = n; m >= 10; m /= 10) {
+            ++expected;
+        }
+        if (jkj::dragonbox::detail::decimal_digit_count(n) != expected) {
+            std::cout << "Error detected in decimal_digit_count! [Input = " << n << "]\n";
+            return false;
+        }
+    }
+    std::cout << "Decimal digit count test with " << samples.size() << " examples succeeded.\n";
+    return true;
+}
+
+template <class Float>
+static bool formatted_length_test(std::size_t number_of_tests, std::string_view type_name) {
+    auto rg = generate_correctly_seeded_mt19937_64();
+    using conversion_traits = jkj::dragonbox::default_float_bit_carrier_conversion_traits<Float>;
+
+    // Random bit patterns including zeros, infinities and NaNs, inputs with few digits and
+    // integers, runs within a binade, and numbers with 1-, 2- and 3-digit exponents.
+    std::vector<Float> samples;
+    for (std::size_t test_idx = 0; test_idx < number_of_tests; ++test_idx) {
+        samples.push_back(uniformly_randomly_generate_general_float<Float>(rg));
+        samples.push_back(randomly_generate_float_with_given_digits<Float>(
+            unsigned(test_idx % conversion_traits::format::decimal_significand_digits) + 1, rg));
+        samples.push_back(Float(test_idx % 1000) * Float(test_idx % 2 == 0 ? 1 : -1));
+        samples.push_back(Float(16) + Float(test_idx % 1024) / 64);
+    }
+    for (int e = std::numeric_limits<Float>::min_exponent10 - 1;
+         e <= std::numeric_limits<Float>::max_exponent10; ++e) {
+        samples.push_back(std::pow(Float(10), Float(e)));
+    }
+    samples.push_back(std::numeric_limits<Float>::infinity());
+    samples.push_back(-std::numeric_limits<Float>::infinity());
+    samples.push_back(std::numeric_limits<Float>::quiet_NaN());
+    samples.push_back(-Float(0));
+    samples.push_back(std::numeric_limits<Float>::denorm_min());
+    samples.push_back(-std::numeric_limits<Float>::max());
+
+    bool success = compare_all(samples);
+    if (success) {
+        std::cout << "Formatted length test for " << type_name << " with " << samples.size()
+                  << " examples succeeded.\n";
+    }
+    return success;
+}
+
+int main() {
+    constexpr std::size_t number_of_tests = 100000;
+    bool success = true;
+
+    std::cout << "[Testing decimal digit count...]\n";
+    success &= decimal_digit_count_test();
+    std::cout << "Done.\n\n\n";
+
+    std::cout << "[Testing formatted length for binary32...]\n";
+    success &= formatted_length_test<float>(number_of_tests, "binary32");
+    std::cout << "Done.\n\n\n";
+
+    std::cout << "[Testing formatted length for binary64...]\n";
+    success &= formatted_length_test<double>(number_of_tests, "binary64");
+    std::cout << "Done.\n\n\n";
+
+    if (!success) {
+        std::cout << "Error detected.\n";
+        return -1;
+    }
+}
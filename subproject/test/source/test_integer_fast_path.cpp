@@ -0,0 +1,142 @@
+// Copyright 2025 Junekey Jeon
+//
+// The contents of this file may be used under the terms of
+// the Apache License v2.0 with LLVM Exceptions.
+//
+//    (See accompanying file LICENSE-Apache or copy at
+//     https://llvm.org/foundation/relicensing/LICENSE.txt)
+//
+// Alternatively, the contents of this file may be used under the terms of
+// the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE-Boost or copy at
+//     https://www.boost.org/LICENSE_1_0.txt)
+//
+// Unless required by applicable law or agreed to in writing, this software
+// is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.
+
+#include "dragonbox/dragonbox_to_chars.h"
+#include "random_float.h"
+
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <iostream>
+#include <limits>
+#include <string_view>
+#include <vector>
+
+namespace policy = jkj::dragonbox::policy;
+
+// Compares the result with the integer fast path against the one without it.
+template <class Float, class... Policies>
+static bool compare(Float x, Policies... policies) {
+    auto const expected =
+        jkj::dragonbox::to_decimal(x, policies..., policy::integer_fast_path::disabled);
+    auto const actual = jkj::dragonbox::to_decimal(x, policies..., policy::integer_fast_path::enabled);
+    if (expected.significand != actual.significand || expected.exponent != actual.exponent ||
+        expected.is_negative != actual.is_negative) {
+        char buffer[64];
+        jkj::dragonbox::to_chars(x, buffer);
+        std::cout << "Error detected in to_decimal! [Input = " << buffer << "]\n";
+        return false;
+    }
+    return true;
+}
+
+template <class Float, class... Policies>
+static bool compare_to_chars(Float x, Policies... policies) {
+    char expected[64], actual[64];
+    jkj::dragonbox::to_chars(x, expected, policies...);
+    jkj::dragonbox::to_chars(x, actual, policies..., policy::integer_fast_path::enabled);
+    if (std::strcmp(expected, actual) != 0) {
+        std::cout << "Error detected in to_chars! [Expected = " << expected
+                  << ", Fast path = " << actual << "]\n";
+        return false;
+    }
+    return true;
+}
+
+template <class Float>
+static bool compare_all(Float x) {
+    namespace d2b = policy::decimal_to_binary_rounding;
+    namespace b2d = policy::binary_to_decimal_rounding;
+    bool success = true;
+    success &= compare(x, d2b::nearest_to_even);
+    success &= compare(x, d2b::nearest_to_odd);
+    success &= compare(x, d2b::nearest_toward_plus_infinity);
+    success &= compare(x, d2b::nearest_toward_minus_infinity);
+    success &= compare(x, d2b::nearest_toward_zero);
+    success &= compare(x, d2b::nearest_away_from_zero);
+    success &= compare(x, d2b::toward_plus_infinity);
+    success &= compare(x, d2b::toward_minus_infinity);
+    success &= compare(x, d2b::toward_zero);
+    success &= compare(x, d2b::away_from_zero);
+    success &= compare(x, b2d::do_not_care);
+    success &= compare(x, b2d::away_from_zero);
+    success &= compare(x, policy::trailing_zero::remove_compact);
+    success &= compare_to_chars(x);
+    success &= compare_to_chars(x, policy::digit_generation::compact);
+    return success;
+}
+
+template <class Float>
+static bool integer_fast_path_test(std::size_t number_of_tests, std::string_view type_name) {
+    constexpr int significand_bits = std::numeric_limits<Float>::digits - 1;
+    auto rg = generate_correctly_seeded_mt19937_64();
+    bool success = true;
+
+    // Small integers, integers of random bit lengths up to 2^(significand_bits + 1) and a bit
+    // above, their neighbors, and random non-integers.
+    std::vector<Float> samples;
+    for (std::uint_least64_t n = 1; n <= 100000; ++n) {
+        samples.push_back(Float(n));
+    }
+    for (int e = 0; e <= significand_bits + 4; ++e) {
+        auto const power = std::ldexp(Float(1), e);
+        samples.push_back(power);
+        samples.push_back(std::nextafter(power, Float(0)));
+        samples.push_back(std::nextafter(power, std::numeric_limits<Float>::infinity()));
+    }
+    for (std::size_t test_idx = 0; test_idx < number_of_tests; ++test_idx) {
+        auto const n = std::uint_least64_t(rg() >> (64 - significand_bits - 3));
+        auto const x = Float(n >> (rg() % (significand_bits + 3)));
+        samples.push_back(x);
+        samples.push_back(-x);
+        samples.push_back(std::nextafter(x, std::numeric_limits<Float>::infinity()));
+        samples.push_back(uniformly_randomly_generate_finite_float<Float>(rg));
+    }
+    for (auto x : samples) {
+        if (x == 0) {
+            continue;
+        }
+        if (!compare_all(x)) {
+            success = false;
+            break;
+        }
+    }
+
+    if (success) {
+        std::cout << "Integer fast path test for " << type_name << " with " << samples.size()
+                  << " examples succeeded.\n";
+    }
+    return success;
+}
+
+int main() {
+    constexpr std::size_t number_of_tests = 100000;
+    bool success = true;
+
+    std::cout << "[Testing integer fast path for binary32...]\n";
+    success &= integer_fast_path_test<float>(number_of_tests, "binary32");
+    std::cout << "Done.\n\n\n";
+
+    std::cout << "[Testing integer fast path for binary64...]\n";
+    success &= integer_fast_path_test<double>(number_of_tests, "binary64");
+    std::cout << "Done.\n\n\n";
+
+    if (!success) {
+        std::cout << "Error detected.\n";
+        return -1;
+    }
+}
@@ -0,0 +1,160 @@
+// Copyright 2025 Junekey Jeon
+//
+// The contents of this file may be used under the terms of
+// the Apache License v2.0 with LLVM Exceptions.
+//
+//    (See accompanying file LICENSE-Apache or copy at
+//     https://llvm.org/foundation/relicensing/LICENSE.txt)
+//
+// Alternatively, the contents of this file may be used under the terms of
+// the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE-Boost or copy at
+//     https://www.boost.org/LICENSE_1_0.txt)
+//
+// Unless required by applicable law or agreed to in writing, this software
+// is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.
+
+#include "dragonbox/dragonbox_to_chars.h"
+#include "random_float.h"
+
+#include <cstdint>
+#include <cstring>
+#include <iostream>
+#include <limits>
+#include <string>
+#include <vector>
+
+// Plain repeated division-by-10, which also works for 128-bit integers.
+template <class UInt>
+static std::string reference_unsigned(UInt n) {
+    std::string str;
+    do {
+        str.insert(str.begin(), char('0' + int(n % 10)));
+        n /= 10;
+    } while (n != 0);
+    return str;
+}
+
+template <class Int, class UInt>
+static std::string reference(Int x) {
+    if (x < 0) {
+        return "-" + reference_unsigned(UInt(UInt(0) - UInt(x)));
+    }
+    return reference_unsigned(UInt(x));
+}
+
+template <class Int, class UInt>
+static bool check(Int x) {
+    char buffer[64];
+    auto const ptr = jkj::dragonbox::to_chars(x, buffer);
+    auto const expected = reference<Int, UInt>(x);
+    if (std::size_t(ptr - buffer) != expected.size() || std::strcmp(buffer, expected.c_str()) != 0) {
+        std::cout << "Error detected! [Expected = " << expected << ", Dragonbox = " << buffer
+                  << "]\n";
+        return false;
+    }
+    return true;
+}
+
+// Values around powers of 10, which are the boundaries of the digit generation branches, and the
+// extreme values of the type.
+template <class Int, class UInt>
+static std::vector<Int> generate_boundary_cases() {
+    std::vector<Int> cases;
+    auto const max_value = UInt(UInt(0) - 1) >> (Int(-1) < 0 ? 1 : 0);
+    UInt power = 1;
+    while (true) {
+        for (int offset = -2; offset <= 2; ++offset) {
+            auto const n = UInt(power + UInt(offset));
+            if (n <= max_value) {
+                cases.push_back(Int(n));
+                if (Int(-1) < 0) {
+                    cases.push_back(Int(UInt(0) - n));
+                }
+            }
+        }
+        if (power > max_value / 10) {
+            break;
+        }
+        power *= 10;
+    }
+    cases.push_back(Int(max_value));
+    cases.push_back(Int(max_value + 1));
+    cases.push_back(Int(max_value - 1));
+    return cases;
+}
+
+template <class Int, class UInt>
+static bool integer_to_chars_test(std::size_t number_of_tests, char const* type_name) {
+    bool success = true;
+
+    for (auto x : generate_boundary_cases<Int, UInt>()) {
+        success &= check<Int, UInt>(x);
+    }
+
+    // Uniformly random bit patterns are mostly of maximum length, so also randomize the length.
+    auto rg = generate_correctly_seeded_mt19937_64();
+    constexpr int bits = int(sizeof(UInt) * 8);
+    for (std::size_t test_idx = 0; test_idx < number_of_tests; ++test_idx) {
+        UInt n = 0;
+        for (int i = 0; i < bits; i += 64) {
+            n = UInt(UInt(n << (bits > 64 ? 64 : 0)) | UInt(rg()));
+        }
+        auto const shift = int(rg() % unsigned(bits));
+        success &= check<Int, UInt>(Int(n));
+        success &= check<Int, UInt>(Int(UInt(n >> shift)));
+    }
+
+    if (success) {
+        std::cout << "Integer to_chars test for " << type_name << " with " << number_of_tests
+                  << " examples succeeded.\n";
+    }
+    return success;
+}
+
+int main() {
+    constexpr std::size_t number_of_tests = 1000000;
+    bool success = true;
+
+    std::cout << "[Testing integer to_chars for all integers less than 10^7...]\n";
+    for (std::uint_least32_t n = 0; n < 10000000; ++n) {
+        if (!check<std::uint_least32_t, std::uint_least32_t>(n)) {
+            success = false;
+            break;
+        }
+    }
+    std::cout << "Done.\n\n\n";
+
+    std::cout << "[Testing integer to_chars for all 8-bit and 16-bit integers...]\n";
+    for (int n = std::numeric_limits<std::int_least16_t>::min();
+         n <= std::numeric_limits<std::int_least16_t>::max(); ++n) {
+        success &= check<std::int_least16_t, std::uint_least16_t>(std::int_least16_t(n));
+        success &= check<std::uint_least16_t, std::uint_least16_t>(std::uint_least16_t(n));
+        success &= check<signed char, unsigned char>((signed char)(n));
+        success &= check<unsigned char, unsigned char>((unsigned char)(n));
+    }
+    std::cout << "Done.\n\n\n";
+
+    std::cout << "[Testing integer to_chars with random inputs...]\n";
+    success &= integer_to_chars_test<std::uint_least32_t, std::uint_least32_t>(number_of_tests,
+                                                                              "uint32");
+    success &=
+        integer_to_chars_test<std::int_least32_t, std::uint_least32_t>(number_of_tests, "int32");
+    success &= integer_to_chars_test<std::uint_least64_t, std::uint_least64_t>(number_of_tests,
+                                                                              "uint64");
+    success &=
+        integer_to_chars_test<std::int_least64_t, std::uint_least64_t>(number_of_tests, "int64");
+#if defined(__SIZEOF_INT128__)
+    __extension__ using int128 = __int128;
+    __extension__ using uint128 = unsigned __int128;
+    success &= integer_to_chars_test<uint128, uint128>(number_of_tests, "uint128");
+    success &= integer_to_chars_test<int128, uint128>(number_of_tests, "int128");
+#endif
+    std::cout << "Done.\n\n\n";
+
+    if (!success) {
+        std::cout << "Error detected.\n";
+        return -1;
+    }
+}
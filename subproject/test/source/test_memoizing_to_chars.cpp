@@ -0,0 +1,131 @@
+// Copyright 2025 Junekey Jeon
+//
+// The contents of this file may be used under the terms of
+// the Apache License v2.0 with LLVM Exceptions.
+//
+//    (See accompanying file LICENSE-Apache or copy at
+//     https://llvm.org/foundation/relicensing/LICENSE.txt)
+//
+// Alternatively, the contents of this file may be used under the terms of
+// the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE-Boost or copy at
+//     https://www.boost.org/LICENSE_1_0.txt)
+//
+// Unless required by applicable law or agreed to in writing, this software
+// is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.
+
+#include "dragonbox/dragonbox_to_chars.h"
+#include "random_float.h"
+
+#include <cmath>
+#include <cstring>
+#include <iostream>
+#include <limits>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+template <class Float>
+static bool compare(Float x) {
+    char expected[64], actual[64];
+    jkj::dragonbox::to_chars(x, expected);
+    jkj::dragonbox::memoizing_to_chars(x, actual);
+    if (std::strcmp(expected, actual) != 0) {
+        std::cout << "Error detected! [Expected = " << expected << ", Memoized = " << actual
+                  << "]\n";
+        return false;
+    }
+    return true;
+}
+
+// A few values repeated among random values, so that both hits and evictions happen.
+template <class Float>
+static bool memoizing_test(std::size_t number_of_tests, std::string_view type_name) {
+    auto rg = generate_correctly_seeded_mt19937_64();
+    bool success = true;
+
+    std::vector<Float> repeated = {Float(0),
+                                   -Float(0),
+                                   Float(1),
+                                   Float(0.5),
+                                   Float(0.95),
+                                   Float(-1e-7),
+                                   std::numeric_limits<Float>::infinity(),
+                                   std::numeric_limits<Float>::quiet_NaN(),
+                                   std::numeric_limits<Float>::max(),
+                                   -std::numeric_limits<Float>::denorm_min()};
+    jkj::dragonbox::reset_memoizing_statistics();
+    for (std::size_t test_idx = 0; test_idx < number_of_tests; ++test_idx) {
+        auto const x = test_idx % 2 == 0 ? repeated[rg() % repeated.size()]
+                                         : uniformly_randomly_generate_general_float<Float>(rg);
+        if (!compare(x)) {
+            success = false;
+            break;
+        }
+    }
+
+    auto const statistics = jkj::dragonbox::get_memoizing_statistics();
+    if (success && statistics.hits + statistics.misses != number_of_tests) {
+        std::cout << "Error detected! [" << statistics.hits << " hits and " << statistics.misses
+                  << " misses for " << number_of_tests << " calls]\n";
+        success = false;
+    }
+    // Each of the repeated values misses at least once, and otherwise only when evicted.
+    if (success && (statistics.hits < number_of_tests / 4 || statistics.hits > number_of_tests / 2)) {
+        std::cout << "Error detected! [Unexpected number of hits: " << statistics.hits << "]\n";
+        success = false;
+    }
+
+    if (success) {
+        std::cout << "Memoizing test for " << type_name << " with " << number_of_tests
+                  << " examples succeeded, " << statistics.hits << " hits.\n";
+    }
+    return success;
+}
+
+// The cache and the statistics are per-thread.
+static bool thread_test() {
+    jkj::dragonbox::reset_memoizing_statistics();
+    char buffer[64];
+    jkj::dragonbox::memoizing_to_chars(0.25, buffer);
+    jkj::dragonbox::memoizing_to_chars(0.25, buffer);
+
+    jkj::dragonbox::memoizing_statistics other_thread_statistics{};
+    std::thread([&] {
+        char buffer[64];
+        jkj::dragonbox::memoizing_to_chars(0.25, buffer);
+        other_thread_statistics = jkj::dragonbox::get_memoizing_statistics();
+    }).join();
+
+    auto const statistics = jkj::dragonbox::get_memoizing_statistics();
+    if (statistics.hits != 1 || statistics.misses != 1 || other_thread_statistics.hits != 0 ||
+        other_thread_statistics.misses != 1) {
+        std::cout << "Error detected! [The statistics are not per-thread]\n";
+        return false;
+    }
+    std::cout << "Thread test succeeded.\n";
+    return true;
+}
+
+int main() {
+    constexpr std::size_t number_of_tests = 1000000;
+    bool success = true;
+
+    std::cout << "[Testing memoizing_to_chars for binary32...]\n";
+    success &= memoizing_test<float>(number_of_tests, "binary32");
+    std::cout << "Done.\n\n\n";
+
+    std::cout << "[Testing memoizing_to_chars for binary64...]\n";
+    success &= memoizing_test<double>(number_of_tests, "binary64");
+    std::cout << "Done.\n\n\n";
+
+    std::cout << "[Testing memoizing_to_chars with threads...]\n";
+    success &= thread_test();
+    std::cout << "Done.\n\n\n";
+
+    if (!success) {
+        std::cout << "Error detected.\n";
+        return -1;
+    }
+}
@@ -0,0 +1,113 @@
+// Copyright 2025 Junekey Jeon
+//
+// The contents of this file may be used under the terms of
+// the Apache License v2.0 with LLVM Exceptions.
+//
+//    (See accompanying file LICENSE-Apache or copy at
+//     https://llvm.org/foundation/relicensing/LICENSE.txt)
+//
+// Alternatively, the contents of this file may be used under the terms of
+// the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE-Boost or copy at
+//     https://www.boost.org/LICENSE_1_0.txt)
+//
+// Unless required by applicable law or agreed to in writing, this software
+// is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.
+
+#include "dragonbox/dragonbox_to_chars.h"
+#include "random_float.h"
+
+#include <cmath>
+#include <iostream>
+#include <limits>
+#include <string>
+#include <string_view>
+#include <vector>
+
+// Compares the result against calling to_chars_n for each input.
+template <class Float>
+static bool compare(std::vector<Float> const& samples, unsigned int thread_count) {
+    constexpr auto max_length = jkj::dragonbox::max_output_string_length<
+        typename jkj::dragonbox::default_float_bit_carrier_conversion_traits<Float>::format>;
+
+    std::string expected;
+    for (auto x : samples) {
+        char buffer[max_length];
+        expected.append(buffer, jkj::dragonbox::to_chars_n(x, buffer));
+        expected.push_back(',');
+    }
+
+    // One more character for the null terminator and one more to detect writing past it.
+    std::vector<char> actual(samples.size() * (max_length + 1) + 2, '#');
+    auto const end = jkj::dragonbox::parallel_to_chars(
+        samples.data(), samples.data() + samples.size(), actual.data(), ',', thread_count);
+    if (std::string_view(actual.data(), std::size_t(end - actual.data())) != expected ||
+        end[0] != '\0' || end[1] != '#') {
+        std::cout << "Error detected! [" << samples.size() << " inputs, " << thread_count
+                  << " threads]\n";
+        return false;
+    }
+    return true;
+}
+
+template <class Float>
+static bool parallel_to_chars_test(std::size_t number_of_tests, std::string_view type_name) {
+    auto rg = generate_correctly_seeded_mt19937_64();
+    bool success = true;
+
+    // Random inputs including zeros, infinities and NaNs, of counts that are less than, equal to,
+    // and not a multiple of the size of the chunks handed out to the threads.
+    std::vector<Float> samples;
+    for (std::size_t test_idx = 0; test_idx < number_of_tests; ++test_idx) {
+        switch (test_idx % 8) {
+        case 0:
+            samples.push_back(test_idx % 16 == 0 ? Float(0) : -Float(0));
+            break;
+        case 1:
+            samples.push_back(Float(test_idx));
+            break;
+        case 2:
+            samples.push_back(randomly_generate_float_with_given_digits<Float>(
+                unsigned(rg() % 6) + 1, rg));
+            break;
+        default:
+            samples.push_back(uniformly_randomly_generate_general_float<Float>(rg));
+            break;
+        }
+    }
+    samples.push_back(std::numeric_limits<Float>::infinity());
+    samples.push_back(-std::numeric_limits<Float>::quiet_NaN());
+
+    for (std::size_t size : {std::size_t(0), std::size_t(1), std::size_t(1000), std::size_t(16384),
+                             samples.size()}) {
+        std::vector<Float> const slice(samples.end() - std::ptrdiff_t(size), samples.end());
+        for (unsigned int thread_count : {0u, 1u, 2u, 3u, 8u}) {
+            success &= compare(slice, thread_count);
+        }
+    }
+
+    if (success) {
+        std::cout << "Parallel to_chars test for " << type_name << " with " << samples.size()
+                  << " examples succeeded.\n";
+    }
+    return success;
+}
+
+int main() {
+    constexpr std::size_t number_of_tests = 100000;
+    bool success = true;
+
+    std::cout << "[Testing parallel to_chars for binary32...]\n";
+    success &= parallel_to_chars_test<float>(number_of_tests, "binary32");
+    std::cout << "Done.\n\n\n";
+
+    std::cout << "[Testing parallel to_chars for binary64...]\n";
+    success &= parallel_to_chars_test<double>(number_of_tests, "binary64");
+    std::cout << "Done.\n\n\n";
+
+    if (!success) {
+        std::cout << "Error detected.\n";
+        return -1;
+    }
+}
@@ -0,0 +1,154 @@
+// Copyright 2025 Junekey Jeon
+//
+// The contents of this file may be used under the terms of
+// the Apache License v2.0 with LLVM Exceptions.
+//
+//    (See accompanying file LICENSE-Apache or copy at
+//     https://llvm.org/foundation/relicensing/LICENSE.txt)
+//
+// Alternatively, the contents of this file may be used under the terms of
+// the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE-Boost or copy at
+//     https://www.boost.org/LICENSE_1_0.txt)
+//
+// Unless required by applicable law or agreed to in writing, this software
+// is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.
+
+#include "dragonbox/dragonbox_to_chars.h"
+#include "random_float.h"
+
+#include <cmath>
+#include <cstring>
+#include <iostream>
+#include <limits>
+#include <string_view>
+#include <vector>
+
+namespace runtime = jkj::dragonbox::runtime;
+namespace policy = jkj::dragonbox::policy;
+
+// Compares the runtime entry points against the template ones with the corresponding policies.
+template <class Float, class DecimalToBinaryRoundingPolicy, class BinaryToDecimalRoundingPolicy>
+static bool compare(Float x, runtime::policies p) {
+    char expected[64], actual[64];
+    jkj::dragonbox::to_chars(x, expected, DecimalToBinaryRoundingPolicy{},
+                             BinaryToDecimalRoundingPolicy{});
+    runtime::to_chars(x, actual, p);
+    if (std::strcmp(expected, actual) != 0) {
+        std::cout << "Error detected in to_chars! [Expected = " << expected
+                  << ", Runtime = " << actual << "]\n";
+        return false;
+    }
+
+    if (x != 0 && std::isfinite(x)) {
+        auto const expected_decimal = jkj::dragonbox::to_decimal(
+            x, DecimalToBinaryRoundingPolicy{}, BinaryToDecimalRoundingPolicy{});
+        auto const actual_decimal = runtime::to_decimal(x, p);
+        if (expected_decimal.significand != actual_decimal.significand ||
+            expected_decimal.exponent != actual_decimal.exponent ||
+            expected_decimal.is_negative != actual_decimal.is_negative) {
+            std::cout << "Error detected in to_decimal! [Input = " << expected << "]\n";
+            return false;
+        }
+    }
+    return true;
+}
+
+template <class Float, class DecimalToBinaryRoundingPolicy>
+static bool compare_all_binary_to_decimal_rounding(Float x,
+                                                   runtime::decimal_to_binary_rounding mode) {
+    using b2d = runtime::binary_to_decimal_rounding;
+    bool success = true;
+    success &= compare<Float, DecimalToBinaryRoundingPolicy,
+                       policy::binary_to_decimal_rounding::to_even_t>(x, {mode, b2d::to_even});
+    success &= compare<Float, DecimalToBinaryRoundingPolicy,
+                       policy::binary_to_decimal_rounding::to_odd_t>(x, {mode, b2d::to_odd});
+    success &= compare<Float, DecimalToBinaryRoundingPolicy,
+                       policy::binary_to_decimal_rounding::away_from_zero_t>(
+        x, {mode, b2d::away_from_zero});
+    success &= compare<Float, DecimalToBinaryRoundingPolicy,
+                       policy::binary_to_decimal_rounding::toward_zero_t>(
+        x, {mode, b2d::toward_zero});
+    return success;
+}
+
+template <class Float>
+static bool compare_all(Float x) {
+    using d2b = runtime::decimal_to_binary_rounding;
+    namespace p = policy::decimal_to_binary_rounding;
+    bool success = true;
+    success &= compare_all_binary_to_decimal_rounding<Float, p::nearest_to_even_t>(
+        x, d2b::nearest_to_even);
+    success &= compare_all_binary_to_decimal_rounding<Float, p::nearest_to_odd_t>(
+        x, d2b::nearest_to_odd);
+    success &= compare_all_binary_to_decimal_rounding<Float, p::nearest_toward_plus_infinity_t>(
+        x, d2b::nearest_toward_plus_infinity);
+    success &= compare_all_binary_to_decimal_rounding<Float, p::nearest_toward_minus_infinity_t>(
+        x, d2b::nearest_toward_minus_infinity);
+    success &= compare_all_binary_to_decimal_rounding<Float, p::nearest_toward_zero_t>(
+        x, d2b::nearest_toward_zero);
+    success &= compare_all_binary_to_decimal_rounding<Float, p::nearest_away_from_zero_t>(
+        x, d2b::nearest_away_from_zero);
+    success &= compare<Float, p::toward_plus_infinity_t,
+                       policy::binary_to_decimal_rounding::to_even_t>(
+        x, {d2b::toward_plus_infinity});
+    success &= compare<Float, p::toward_minus_infinity_t,
+                       policy::binary_to_decimal_rounding::to_even_t>(
+        x, {d2b::toward_minus_infinity});
+    success &= compare<Float, p::toward_zero_t, policy::binary_to_decimal_rounding::to_even_t>(
+        x, {d2b::toward_zero});
+    success &= compare<Float, p::away_from_zero_t, policy::binary_to_decimal_rounding::to_even_t>(
+        x, {d2b::away_from_zero});
+    return success;
+}
+
+template <class Float>
+static bool runtime_policy_test(std::size_t number_of_tests, std::string_view type_name) {
+    auto rg = generate_correctly_seeded_mt19937_64();
+    bool success = true;
+
+    // Special values, shorter interval cases, and random inputs of both signs.
+    std::vector<Float> samples = {Float(0),
+                                  -Float(0),
+                                  std::numeric_limits<Float>::infinity(),
+                                  -std::numeric_limits<Float>::infinity(),
+                                  std::numeric_limits<Float>::quiet_NaN(),
+                                  std::numeric_limits<Float>::denorm_min(),
+                                  std::numeric_limits<Float>::max(),
+                                  Float(1),
+                                  Float(-0.5)};
+    for (std::size_t test_idx = 0; test_idx < number_of_tests; ++test_idx) {
+        samples.push_back(uniformly_randomly_generate_general_float<Float>(rg));
+    }
+    for (auto x : samples) {
+        if (!compare_all(x)) {
+            success = false;
+            break;
+        }
+    }
+
+    if (success) {
+        std::cout << "Runtime policy test for " << type_name << " with " << samples.size()
+                  << " examples succeeded.\n";
+    }
+    return success;
+}
+
+int main() {
+    constexpr std::size_t number_of_tests = 100000;
+    bool success = true;
+
+    std::cout << "[Testing runtime policies for binary32...]\n";
+    success &= runtime_policy_test<float>(number_of_tests, "binary32");
+    std::cout << "Done.\n\n\n";
+
+    std::cout << "[Testing runtime policies for binary64...]\n";
+    success &= runtime_policy_test<double>(number_of_tests, "binary64");
+    std::cout << "Done.\n\n\n";
+
+    if (!success) {
+        std::cout << "Error detected.\n";
+        return -1;
+    }
+}
@@ -0,0 +1,107 @@
+// Copyright 2025 Junekey Jeon
+//
+// The contents of this file may be used under the terms of
+// the Apache License v2.0 with LLVM Exceptions.
+//
+//    (See accompanying file LICENSE-Apache or copy at
+//     https://llvm.org/foundation/relicensing/LICENSE.txt)
+//
+// Alternatively, the contents of this file may be used under the terms of
+// the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE-Boost or copy at
+//     https://www.boost.org/LICENSE_1_0.txt)
+//
+// Unless required by applicable law or agreed to in writing, this software
+// is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.
+
+// Checks that with JKJ_DRAGONBOX_SHARED_TABLES, a process loading several shared libraries using
+// the cache tables has only one copy of each of them, by searching all loaded objects for the
+// contents of the tables.
+
+#include "dragonbox/dragonbox.h"
+
+#include <link.h>
+
+#include <cstdint>
+#include <cstring>
+#include <iostream>
+#include <string_view>
+#include <vector>
+
+extern "C" std::uint_least64_t test_shared_tables_dso_a(double x, float y);
+extern "C" std::uint_least64_t test_shared_tables_dso_b(double x, float y);
+extern "C" void const* test_shared_tables_dso_a_table(int index);
+extern "C" void const* test_shared_tables_dso_b_table(int index);
+
+struct table_info {
+    std::string_view name;
+    void const* data;
+    std::size_t size;
+    std::size_t number_of_copies;
+};
+
+static int count_copies(dl_phdr_info* info, std::size_t, void* tables_ptr) {
+    auto& tables = *static_cast<std::vector<table_info>*>(tables_ptr);
+    for (int i = 0; i < int(info->dlpi_phnum); ++i) {
+        auto const& phdr = info->dlpi_phdr[i];
+        if (phdr.p_type != PT_LOAD || (phdr.p_flags & PF_R) == 0) {
+            continue;
+        }
+        auto const first = reinterpret_cast<unsigned char const*>(info->dlpi_addr + phdr.p_vaddr);
+        auto const last = first + phdr.p_filesz;
+        for (auto& table : tables) {
+            for (auto ptr = first; ptr + table.size <= last; ptr += alignof(std::uint_least64_t)) {
+                if (std::memcmp(ptr, table.data, table.size) == 0) {
+                    ++table.number_of_copies;
+                }
+            }
+        }
+    }
+    return 0;
+}
+
+int main() {
+    bool success = true;
+
+    std::cout << "[Calling the algorithm from two shared libraries...]\n";
+    if (test_shared_tables_dso_a(1.5, 2.5f) != 15 || test_shared_tables_dso_b(1.5, 2.5f) != 15 ||
+        test_shared_tables_dso_a(1e300, 1e-30f) != 1 ||
+        test_shared_tables_dso_b(1e-300, 1e30f) != 1) {
+        std::cout << "Error detected.\n";
+        success = false;
+    }
+    std::cout << "Done.\n\n\n";
+
+    std::cout << "[Counting the copies of the cache tables...]\n";
+    namespace shared_tables = jkj::dragonbox::detail::shared_tables;
+    // The tables of powers of 5 are not searched for, since they may appear elsewhere.
+    std::vector<table_info> tables = {
+        {"binary32_cache", test_shared_tables_dso_a_table(0),
+         sizeof(shared_tables::jkj_dragonbox_binary32_cache), 0},
+        {"binary64_cache", test_shared_tables_dso_a_table(1),
+         sizeof(shared_tables::jkj_dragonbox_binary64_cache), 0},
+        {"binary32_compressed_cache", test_shared_tables_dso_a_table(2),
+         sizeof(shared_tables::jkj_dragonbox_binary32_compressed_cache), 0},
+        {"binary64_compressed_cache", test_shared_tables_dso_a_table(4),
+         sizeof(shared_tables::jkj_dragonbox_binary64_compressed_cache), 0}};
+    for (int index = 0; index < 6; ++index) {
+        if (test_shared_tables_dso_a_table(index) != test_shared_tables_dso_b_table(index)) {
+            std::cout << "The shared libraries read different tables.\n";
+            success = false;
+        }
+    }
+    dl_iterate_phdr(count_copies, &tables);
+    for (auto const& table : tables) {
+        std::cout << table.name << ": " << table.number_of_copies << " copies\n";
+        if (table.number_of_copies != 1) {
+            success = false;
+        }
+    }
+    std::cout << "Done.\n\n\n";
+
+    if (!success) {
+        std::cout << "Error detected.\n";
+        return -1;
+    }
+}
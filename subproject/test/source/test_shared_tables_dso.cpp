@@ -0,0 +1,65 @@
+// Copyright 2025 Junekey Jeon
+//
+// The contents of this file may be used under the terms of
+// the Apache License v2.0 with LLVM Exceptions.
+//
+//    (See accompanying file LICENSE-Apache or copy at
+//     https://llvm.org/foundation/relicensing/LICENSE.txt)
+//
+// Alternatively, the contents of this file may be used under the terms of
+// the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE-Boost or copy at
+//     https://www.boost.org/LICENSE_1_0.txt)
+//
+// Unless required by applicable law or agreed to in writing, this software
+// is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.
+
+// Compiled into two shared libraries with hidden visibility by default, which would get their own
+// copies of the cache tables without JKJ_DRAGONBOX_SHARED_TABLES. TEST_SHARED_TABLES_DSO_FUNCTION
+// and TEST_SHARED_TABLES_DSO_TABLE are defined differently for each of them, and one of them
+// defines JKJ_NAMESPACE, which should not prevent sharing the tables either.
+
+#ifdef JKJ_NAMESPACE
+    // The instances of the main algorithm in dragonbox_extern_templates live in the usual
+    // namespace.
+    #undef JKJ_DRAGONBOX_EXTERN_TEMPLATES
+#endif
+#define JKJ_DRAGONBOX_LEAK_MACROS
+#include "dragonbox/dragonbox.h"
+
+#include <cstdint>
+
+// Returns the significand of x if the full and the compact caches give the same results for both
+// x and y, and 0 otherwise.
+extern "C" __attribute__((visibility("default"))) std::uint_least64_t
+TEST_SHARED_TABLES_DSO_FUNCTION(double x, float y) {
+    namespace cache = JKJ_NAMESPACE::dragonbox::policy::cache;
+    auto const double_full = JKJ_NAMESPACE::dragonbox::to_decimal(x, cache::full);
+    auto const double_compact = JKJ_NAMESPACE::dragonbox::to_decimal(x, cache::compact);
+    auto const float_full = JKJ_NAMESPACE::dragonbox::to_decimal(y, cache::full);
+    auto const float_compact = JKJ_NAMESPACE::dragonbox::to_decimal(y, cache::compact);
+
+    if (double_full.significand != double_compact.significand ||
+        double_full.exponent != double_compact.exponent ||
+        float_full.significand != float_compact.significand ||
+        float_full.exponent != float_compact.exponent) {
+        return 0;
+    }
+    return double_full.significand;
+}
+
+// Returns the address of the index-th table this library reads, in the order of declarations in
+// dragonbox.h. The test program cannot refer to them directly, since then they may be copied
+// into the executable through copy relocations.
+extern "C" __attribute__((visibility("default"))) void const*
+TEST_SHARED_TABLES_DSO_TABLE(int index) {
+    namespace shared_tables = JKJ_NAMESPACE::dragonbox::detail::shared_tables;
+    void const* const tables[] = {&shared_tables::jkj_dragonbox_binary32_cache,
+                                  &shared_tables::jkj_dragonbox_binary64_cache,
+                                  &shared_tables::jkj_dragonbox_binary32_compressed_cache,
+                                  &shared_tables::jkj_dragonbox_binary32_pow5_table,
+                                  &shared_tables::jkj_dragonbox_binary64_compressed_cache,
+                                  &shared_tables::jkj_dragonbox_binary64_pow5_table};
+    return tables[index];
+}
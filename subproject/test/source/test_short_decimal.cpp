@@ -0,0 +1,150 @@
+// Copyright 2025 Junekey Jeon
+//
+// The contents of this file may be used under the terms of
+// the Apache License v2.0 with LLVM Exceptions.
+//
+//    (See accompanying file LICENSE-Apache or copy at
+//     https://llvm.org/foundation/relicensing/LICENSE.txt)
+//
+// Alternatively, the contents of this file may be used under the terms of
+// the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE-Boost or copy at
+//     https://www.boost.org/LICENSE_1_0.txt)
+//
+// Unless required by applicable law or agreed to in writing, this software
+// is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.
+
+#include "dragonbox/dragonbox_to_chars.h"
+#include "random_float.h"
+
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <iostream>
+#include <string_view>
+#include <vector>
+
+namespace policy = jkj::dragonbox::policy;
+
+// Checks that an accepted candidate is the shortest representation, and that the output of
+// to_chars is not changed by the policy.
+template <class Float>
+static bool check(Float x, std::size_t& number_of_accepted) {
+    using conversion_traits = jkj::dragonbox::default_float_bit_carrier_conversion_traits<Float>;
+    using format_traits =
+        jkj::dragonbox::ieee754_binary_traits<typename conversion_traits::format,
+                                              typename conversion_traits::carrier_uint>;
+    auto const br = jkj::dragonbox::make_float_bits<Float, conversion_traits, format_traits>(x);
+    auto const candidate = jkj::dragonbox::detail::short_decimal<format_traits>::compute(
+        br.remove_exponent_bits(), br.extract_exponent_bits());
+    if (candidate.significand == 0) {
+        return true;
+    }
+    ++number_of_accepted;
+
+    auto significand = candidate.significand;
+    auto exponent = candidate.exponent;
+    while (significand % 10 == 0) {
+        significand /= 10;
+        ++exponent;
+    }
+    auto const expected = jkj::dragonbox::to_decimal(x, policy::sign::ignore);
+    if (expected.significand != significand || expected.exponent != exponent) {
+        char buffer[64];
+        jkj::dragonbox::to_chars(x, buffer);
+        std::cout << "Error detected! [Input = " << buffer << ", Candidate = " << significand
+                  << "E" << exponent << "]\n";
+        return false;
+    }
+    return true;
+}
+
+template <class Float>
+static bool compare_to_chars(Float x) {
+    char expected[64], actual[64];
+    jkj::dragonbox::to_chars(x, expected);
+    jkj::dragonbox::to_chars(x, actual, policy::digit_generation::short_decimal_first);
+    if (std::strcmp(expected, actual) != 0) {
+        std::cout << "Error detected in to_chars! [Expected = " << expected
+                  << ", Short decimal first = " << actual << "]\n";
+        return false;
+    }
+    return true;
+}
+
+// All positive normal numbers.
+static bool exhaustive_binary32_test() {
+    std::size_t number_of_accepted = 0;
+    bool success = true;
+    for (std::uint32_t u = 0x0080'0000; u < 0x7f80'0000; ++u) {
+        float x;
+        std::memcpy(&x, &u, sizeof(x));
+        if (!check(x, number_of_accepted)) {
+            success = false;
+            break;
+        }
+    }
+
+    if (success) {
+        std::cout << "Exhaustive test for binary32 succeeded, " << number_of_accepted
+                  << " inputs took the short path.\n";
+    }
+    return success;
+}
+
+template <class Float>
+static bool random_test(std::size_t number_of_tests, std::string_view type_name) {
+    using conversion_traits = jkj::dragonbox::default_float_bit_carrier_conversion_traits<Float>;
+    auto rg = generate_correctly_seeded_mt19937_64();
+    std::size_t number_of_accepted = 0;
+    bool success = true;
+
+    // Prices with up to 4 fractional digits, numbers with few digits, their neighbors, and random
+    // numbers.
+    std::vector<Float> samples;
+    for (std::size_t test_idx = 0; test_idx < number_of_tests; ++test_idx) {
+        auto const price = Float(rg() % 10'000'000) / Float(100);
+        samples.push_back(price);
+        samples.push_back(std::nextafter(price, Float(0)));
+        samples.push_back(Float(rg() % 1'000'000) / Float(10'000));
+        samples.push_back(randomly_generate_float_with_given_digits<Float>(
+            unsigned(test_idx % conversion_traits::format::decimal_significand_digits) + 1, rg));
+        samples.push_back(uniformly_randomly_generate_finite_float<Float>(rg));
+    }
+    for (auto x : samples) {
+        if (x == 0 || !std::isfinite(x)) {
+            continue;
+        }
+        if (!check(x, number_of_accepted) || !compare_to_chars(x) || !compare_to_chars(-x)) {
+            success = false;
+            break;
+        }
+    }
+
+    if (success) {
+        std::cout << "Random test for " << type_name << " with " << samples.size()
+                  << " examples succeeded, " << number_of_accepted
+                  << " inputs took the short path.\n";
+    }
+    return success;
+}
+
+int main() {
+    constexpr std::size_t number_of_tests = 300'000;
+    bool success = true;
+
+    std::cout << "[Testing short decimal fast path for binary32...]\n";
+    success &= exhaustive_binary32_test();
+    success &= random_test<float>(number_of_tests, "binary32");
+    std::cout << "Done.\n\n\n";
+
+    std::cout << "[Testing short decimal fast path for binary64...]\n";
+    success &= random_test<double>(number_of_tests, "binary64");
+    std::cout << "Done.\n\n\n";
+
+    if (!success) {
+        std::cout << "Error detected.\n";
+        return -1;
+    }
+}
@@ -0,0 +1,154 @@
+// Copyright 2025 Junekey Jeon
+//
+// The contents of this file may be used under the terms of
+// the Apache License v2.0 with LLVM Exceptions.
+//
+//    (See accompanying file LICENSE-Apache or copy at
+//     https://llvm.org/foundation/relicensing/LICENSE.txt)
+//
+// Alternatively, the contents of this file may be used under the terms of
+// the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE-Boost or copy at
+//     https://www.boost.org/LICENSE_1_0.txt)
+//
+// Unless required by applicable law or agreed to in writing, this software
+// is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.
+
+#define JKJ_DRAGONBOX_ENABLE_STATS 1
+// The counters are enabled only in this translation unit, so the main algorithm should not come from
+// the dragonbox_extern_templates library.
+#undef JKJ_DRAGONBOX_EXTERN_TEMPLATES
+#if defined(__has_include)
+    #if __has_include(<sys/sdt.h>)
+        #define JKJ_DRAGONBOX_ENABLE_USDT_PROBES 1
+    #endif
+#endif
+#include "dragonbox/dragonbox.h"
+#include "random_float.h"
+
+#include <cstdint>
+#include <iostream>
+#include <thread>
+
+template <class Float>
+static bool is_shorter_interval_case(Float x) {
+    auto const br = jkj::dragonbox::make_float_bits<Float>(x);
+    return br.extract_exponent_bits() != 0 && br.extract_significand_bits() == 0;
+}
+
+template <class Float>
+static bool stats_test(std::size_t number_of_tests) {
+    namespace stats = jkj::dragonbox::stats;
+    namespace policy = jkj::dragonbox::policy;
+
+    auto rg = generate_correctly_seeded_mt19937_64();
+    bool success = true;
+
+    // Nearest rounding.
+    std::uint_least64_t expected_shorter_interval_cases = 0;
+    std::uint_least64_t expected_trailing_zeros_removed = 0;
+    stats::reset();
+    for (std::size_t test_idx = 0; test_idx < number_of_tests; ++test_idx) {
+        auto x = uniformly_randomly_generate_finite_float<Float>(rg);
+        if (x == 0) {
+            continue;
+        }
+        // Make shorter interval cases not too rare.
+        if (test_idx % 64 == 0) {
+            x = Float(1) / Float(1 << (test_idx % 16));
+        }
+        expected_shorter_interval_cases += is_shorter_interval_case(x) ? 1 : 0;
+
+        auto const with_zeros = jkj::dragonbox::to_decimal(x, policy::trailing_zero::ignore);
+        auto const without_zeros = jkj::dragonbox::to_decimal(x);
+        expected_trailing_zeros_removed +=
+            std::uint_least64_t(without_zeros.exponent - with_zeros.exponent);
+    }
+    auto const nearest = stats::get();
+
+    // Every conversion was done twice.
+    auto const number_of_calls = nearest.nearest_calls / 2;
+    if (nearest.nearest_calls % 2 != 0 || nearest.left_closed_directed_calls != 0 ||
+        nearest.right_closed_directed_calls != 0) {
+        std::cout << "Wrong number of calls.\n";
+        success = false;
+    }
+    if (nearest.shorter_interval_cases != expected_shorter_interval_cases * 2) {
+        std::cout << "Wrong number of shorter interval cases. [Expected = "
+                  << expected_shorter_interval_cases * 2
+                  << ", Counted = " << nearest.shorter_interval_cases << "]\n";
+        success = false;
+    }
+    if (nearest.shorter_interval_cases + nearest.big_divisor_exits + nearest.small_divisor_cases !=
+        nearest.nearest_calls) {
+        std::cout << "Branch counts do not add up to the number of calls.\n";
+        success = false;
+    }
+    if (nearest.trailing_zeros_removed != expected_trailing_zeros_removed) {
+        std::cout << "Wrong number of removed trailing zeros. [Expected = "
+                  << expected_trailing_zeros_removed
+                  << ", Counted = " << nearest.trailing_zeros_removed << "]\n";
+        success = false;
+    }
+    if (nearest.trailing_zero_removals > nearest.nearest_calls) {
+        std::cout << "Too many trailing zero removals.\n";
+        success = false;
+    }
+
+    // Directed rounding.
+    stats::reset();
+    for (std::size_t test_idx = 0; test_idx < number_of_calls; ++test_idx) {
+        auto x = uniformly_randomly_generate_finite_float<Float>(rg);
+        if (x == 0) {
+            continue;
+        }
+        jkj::dragonbox::to_decimal(x, policy::decimal_to_binary_rounding::toward_zero);
+        jkj::dragonbox::to_decimal(x, policy::decimal_to_binary_rounding::away_from_zero);
+    }
+    auto const directed = stats::get();
+    if (directed.nearest_calls != 0 || directed.shorter_interval_cases != 0 ||
+        directed.left_closed_directed_calls + directed.right_closed_directed_calls == 0 ||
+        directed.big_divisor_exits + directed.small_divisor_cases !=
+            directed.left_closed_directed_calls + directed.right_closed_directed_calls) {
+        std::cout << "Wrong counts for directed rounding.\n";
+        success = false;
+    }
+
+    // Counters are per-thread.
+    stats::reset();
+    std::thread([] { jkj::dragonbox::to_decimal(Float(0.3)); }).join();
+    if (stats::get().nearest_calls != 0) {
+        std::cout << "Counters are shared across threads.\n";
+        success = false;
+    }
+
+    if (success) {
+        std::cout << "Stats test with " << number_of_tests << " examples succeeded. "
+                  << "[shorter interval = " << nearest.shorter_interval_cases
+                  << ", big divisor = " << nearest.big_divisor_exits
+                  << ", small divisor = " << nearest.small_divisor_cases
+                  << ", trailing zeros removed = " << nearest.trailing_zeros_removed << "]\n";
+    }
+    else {
+        std::cout << "Error detected.\n";
+    }
+    return success;
+}
+
+int main() {
+    constexpr std::size_t number_of_tests = 1000000;
+    bool success = true;
+
+    std::cout << "[Testing stats counters for binary32...]\n";
+    success &= stats_test<float>(number_of_tests);
+    std::cout << "Done.\n\n\n";
+
+    std::cout << "[Testing stats counters for binary64...]\n";
+    success &= stats_test<double>(number_of_tests);
+    std::cout << "Done.\n\n\n";
+
+    if (!success) {
+        return -1;
+    }
+}
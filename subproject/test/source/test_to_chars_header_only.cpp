@@ -0,0 +1,98 @@
+// Copyright 2025 Junekey Jeon
+//
+// The contents of this file may be used under the terms of
+// the Apache License v2.0 with LLVM Exceptions.
+//
+//    (See accompanying file LICENSE-Apache or copy at
+//     https://llvm.org/foundation/relicensing/LICENSE.txt)
+//
+// Alternatively, the contents of this file may be used under the terms of
+// the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE-Boost or copy at
+//     https://www.boost.org/LICENSE_1_0.txt)
+//
+// Unless required by applicable law or agreed to in writing, this software
+// is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.
+
+// Built against dragonbox_to_chars_header_only, so the digit printers are compiled into this
+// translation unit. Their output is compared against the one of the compact digit generation
+// policy, which does not depend on them, and against std::to_chars for integers.
+
+#include "dragonbox/dragonbox_to_chars.h"
+#include "random_float.h"
+
+#include <charconv>
+#include <cstdint>
+#include <cstring>
+#include <iostream>
+#include <limits>
+#include <string_view>
+
+template <class Float>
+static bool header_only_float_test(std::size_t number_of_tests, std::string_view type_name) {
+    auto rg = generate_correctly_seeded_mt19937_64();
+    bool success = true;
+    for (std::size_t test_idx = 0; test_idx < number_of_tests; ++test_idx) {
+        auto const x = uniformly_randomly_generate_general_float<Float>(rg);
+        char expected[64], actual[64];
+        jkj::dragonbox::to_chars(x, expected, jkj::dragonbox::policy::digit_generation::compact);
+        jkj::dragonbox::to_chars(x, actual);
+        if (std::strcmp(expected, actual) != 0) {
+            std::cout << "Error detected! [Expected = " << expected << ", Dragonbox = " << actual
+                      << "]\n";
+            success = false;
+        }
+    }
+
+    if (success) {
+        std::cout << "Header-only to_chars test for " << type_name << " with " << number_of_tests
+                  << " examples succeeded.\n";
+    }
+    return success;
+}
+
+template <class Int>
+static bool header_only_integer_test(std::size_t number_of_tests, std::string_view type_name) {
+    auto rg = generate_correctly_seeded_mt19937_64();
+    bool success = true;
+    for (std::size_t test_idx = 0; test_idx < number_of_tests; ++test_idx) {
+        // Randomize the length as well.
+        auto const x = Int(rg() >> (rg() % 64));
+        char expected[64], actual[64];
+        auto const expected_end =
+            std::to_chars(expected, expected + sizeof(expected), x).ptr;
+        auto const actual_end = jkj::dragonbox::to_chars_n(x, actual);
+        if (std::string_view(expected, std::size_t(expected_end - expected)) !=
+            std::string_view(actual, std::size_t(actual_end - actual))) {
+            std::cout << "Error detected! [Expected = "
+                      << std::string_view(expected, std::size_t(expected_end - expected))
+                      << ", Dragonbox = "
+                      << std::string_view(actual, std::size_t(actual_end - actual)) << "]\n";
+            success = false;
+        }
+    }
+
+    if (success) {
+        std::cout << "Header-only to_chars test for " << type_name << " with " << number_of_tests
+                  << " examples succeeded.\n";
+    }
+    return success;
+}
+
+int main() {
+    constexpr std::size_t number_of_tests = 1000000;
+    bool success = true;
+
+    std::cout << "[Testing header-only to_chars...]\n";
+    success &= header_only_float_test<float>(number_of_tests, "binary32");
+    success &= header_only_float_test<double>(number_of_tests, "binary64");
+    success &= header_only_integer_test<std::uint_least64_t>(number_of_tests, "uint64");
+    success &= header_only_integer_test<std::int_least64_t>(number_of_tests, "int64");
+    std::cout << "Done.\n\n\n";
+
+    if (!success) {
+        std::cout << "Error detected.\n";
+        return -1;
+    }
+}
@@ -0,0 +1,137 @@
+// Copyright 2025 Junekey Jeon
+//
+// The contents of this file may be used under the terms of
+// the Apache License v2.0 with LLVM Exceptions.
+//
+//    (See accompanying file LICENSE-Apache or copy at
+//     https://llvm.org/foundation/relicensing/LICENSE.txt)
+//
+// Alternatively, the contents of this file may be used under the terms of
+// the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE-Boost or copy at
+//     https://www.boost.org/LICENSE_1_0.txt)
+//
+// Unless required by applicable law or agreed to in writing, this software
+// is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.
+
+#include "dragonbox/dragonbox_to_chars.h"
+#include "policy_comparison.h"
+#include "random_float.h"
+
+#include <cmath>
+#include <iostream>
+#include <limits>
+#include <string_view>
+#include <vector>
+
+namespace policy = jkj::dragonbox::policy;
+
+// Compares the batch conversion against to_decimal with the same policies.
+template <class Float, class... Policies>
+static bool compare(std::vector<Float> const& samples, Policies... policies) {
+    using result_type = decltype(jkj::dragonbox::to_decimal(Float(1), policies...));
+    std::vector<result_type> results(samples.size());
+    auto const end = jkj::dragonbox::to_decimal_batch(samples.data(),
+                                                      samples.data() + samples.size(),
+                                                      results.data(), policies...);
+    if (end != results.data() + results.size()) {
+        std::cout << "Error detected in to_decimal_batch! [Wrong output end]\n";
+        return false;
+    }
+    for (std::size_t idx = 0; idx < samples.size(); ++idx) {
+        if (!is_identical(jkj::dragonbox::to_decimal(samples[idx], policies...), results[idx])) {
+            char buffer[64];
+            jkj::dragonbox::to_chars(samples[idx], buffer);
+            std::cout << "Error detected in to_decimal_batch! [Input = " << buffer << "]\n";
+            return false;
+        }
+    }
+    return true;
+}
+
+template <class Float>
+static bool compare_all(std::vector<Float> const& samples) {
+    namespace d2b = policy::decimal_to_binary_rounding;
+    auto const compare_samples = [&samples](auto... policies) {
+        return compare(samples, policies...);
+    };
+    bool success = true;
+    success &= compare_all_binary_to_decimal_rounding<d2b::nearest_to_even_t>(compare_samples);
+    success &= compare_all_binary_to_decimal_rounding<d2b::nearest_to_odd_t>(compare_samples);
+    success &=
+        compare_all_binary_to_decimal_rounding<d2b::nearest_toward_plus_infinity_t>(compare_samples);
+    success &=
+        compare_all_binary_to_decimal_rounding<d2b::nearest_toward_minus_infinity_t>(compare_samples);
+    success &= compare_all_binary_to_decimal_rounding<d2b::nearest_toward_zero_t>(compare_samples);
+    success &= compare_all_binary_to_decimal_rounding<d2b::nearest_away_from_zero_t>(compare_samples);
+    success &= compare(samples, d2b::nearest_to_even_static_boundary);
+    success &= compare(samples, d2b::nearest_to_odd_static_boundary);
+    success &= compare(samples, d2b::nearest_toward_plus_infinity_static_boundary);
+    success &= compare(samples, d2b::nearest_toward_minus_infinity_static_boundary);
+    success &= compare(samples, d2b::toward_plus_infinity);
+    success &= compare(samples, d2b::toward_minus_infinity);
+    success &= compare(samples, d2b::toward_zero);
+    success &= compare(samples, d2b::away_from_zero);
+    success &= compare(samples, policy::trailing_zero::ignore);
+    success &= compare(samples, policy::trailing_zero::report);
+    success &= compare(samples, policy::trailing_zero::remove_compact);
+    success &= compare(samples, policy::sign::ignore, policy::cache::compact);
+    success &= compare(samples, policy::integer_fast_path::enabled);
+    success &= compare(samples, policy::branching::branchless);
+    return success;
+}
+
+template <class Float>
+static bool to_decimal_batch_test(std::size_t number_of_tests, std::string_view type_name) {
+    auto rg = generate_correctly_seeded_mt19937_64();
+    std::uniform_real_distribution<Float> narrow_range{Float(16), Float(32)};
+
+    // Runs of inputs sharing the exponent bits, inputs alternating between two binades, and
+    // random inputs that almost never share them. Powers of two fall into the shorter interval
+    // case in the middle of a run, and integers into the integer fast path.
+    std::vector<Float> samples;
+    for (std::size_t test_idx = 0; test_idx < number_of_tests; ++test_idx) {
+        samples.push_back(narrow_range(rg));
+    }
+    for (std::size_t test_idx = 0; test_idx < number_of_tests; ++test_idx) {
+        samples.push_back(test_idx % 2 == 0 ? narrow_range(rg) : -narrow_range(rg) / 2);
+    }
+    for (std::size_t test_idx = 0; test_idx < number_of_tests; ++test_idx) {
+        samples.push_back(uniformly_randomly_generate_finite_float<Float>(rg));
+        samples.push_back(Float(rg() % 1000 + 1));
+        samples.push_back(std::ldexp(Float(1), int(rg() % 64) - 32));
+    }
+    auto subnormal = std::numeric_limits<Float>::denorm_min();
+    for (std::size_t test_idx = 0; test_idx < number_of_tests; ++test_idx) {
+        samples.push_back(subnormal);
+        subnormal = std::nextafter(subnormal, Float(1));
+    }
+    samples.push_back(std::numeric_limits<Float>::min());
+    samples.push_back(std::numeric_limits<Float>::max());
+
+    bool success = compare_all(samples);
+    if (success) {
+        std::cout << "Batch conversion test for " << type_name << " with " << samples.size()
+                  << " examples succeeded.\n";
+    }
+    return success;
+}
+
+int main() {
+    constexpr std::size_t number_of_tests = 100000;
+    bool success = true;
+
+    std::cout << "[Testing batch conversion for binary32...]\n";
+    success &= to_decimal_batch_test<float>(number_of_tests, "binary32");
+    std::cout << "Done.\n\n\n";
+
+    std::cout << "[Testing batch conversion for binary64...]\n";
+    success &= to_decimal_batch_test<double>(number_of_tests, "binary64");
+    std::cout << "Done.\n\n\n";
+
+    if (!success) {
+        std::cout << "Error detected.\n";
+        return -1;
+    }
+}
@@ -64,11 +64,18 @@ int main() {
     constexpr std::size_t number_of_uniform_random_tests_float = 10000000;
     constexpr bool run_float = true;
     constexpr bool run_float_with_compact_cache = true;
+    constexpr bool run_float_with_lazy_full_cache = true;
+    constexpr bool run_float_with_range_cache = true;
+    constexpr bool run_float_with_exponent_indexed_cache = true;
+    constexpr bool run_float_with_shared_cache = true;
     constexpr bool run_simple_float = true;
 
     constexpr std::size_t number_of_uniform_random_tests_double = 10000000;
     constexpr bool run_double = true;
     constexpr bool run_double_with_compact_cache = true;
+    constexpr bool run_double_with_lazy_full_cache = true;
+    constexpr bool run_double_with_range_cache = true;
+    constexpr bool run_double_with_exponent_indexed_cache = true;
     constexpr bool run_simple_double = true;
 
     bool success = true;
@@ -89,6 +96,44 @@ int main() {
             });
         std::cout << "Done.\n\n\n";
     }
+    if (run_float_with_lazy_full_cache) {
+        std::cout << "[Testing uniformly randomly generated binary32 inputs (lazy full cache)...]\n";
+        success &=
+            uniform_random_test<float>(number_of_uniform_random_tests_float, [](auto x, char* buffer) {
+                jkj::dragonbox::to_chars(x, buffer, jkj::dragonbox::policy::cache::lazy_full);
+            });
+        std::cout << "Done.\n\n\n";
+    }
+    if (run_float_with_range_cache) {
+        std::cout << "[Testing uniformly randomly generated binary32 inputs (range cache)...]\n";
+        success &=
+            uniform_random_test<float>(number_of_uniform_random_tests_float, [](auto x, char* buffer) {
+                jkj::dragonbox::to_chars(x, buffer,
+                                         jkj::dragonbox::policy::cache::range_t<-12, 12>{});
+            });
+        std::cout << "Done.\n\n\n";
+    }
+    if (run_float_with_exponent_indexed_cache) {
+        std::cout
+            << "[Testing uniformly randomly generated binary32 inputs (exponent-indexed cache)...]\n";
+        success &=
+            uniform_random_test<float>(number_of_uniform_random_tests_float, [](auto x, char* buffer) {
+                jkj::dragonbox::to_chars(x, buffer, jkj::dragonbox::policy::cache::exponent_indexed);
+            });
+        std::cout << "Done.\n\n\n";
+    }
+    if (run_float_with_shared_cache) {
+        std::cout << "[Testing uniformly randomly generated binary32 inputs (shared cache)...]\n";
+        success &=
+            uniform_random_test<float>(number_of_uniform_random_tests_float, [](auto x, char* buffer) {
+                jkj::dragonbox::to_chars(x, buffer, jkj::dragonbox::policy::cache::shared_full);
+            });
+        success &=
+            uniform_random_test<float>(number_of_uniform_random_tests_float, [](auto x, char* buffer) {
+                jkj::dragonbox::to_chars(x, buffer, jkj::dragonbox::policy::cache::shared_compact);
+            });
+        std::cout << "Done.\n\n\n";
+    }
     if (run_simple_float) {
         std::cout << "[Testing uniformly randomly generated binary32 inputs (simplified impl)...]\n";
         success &=
@@ -112,6 +157,32 @@ int main() {
             });
         std::cout << "Done.\n\n\n";
     }
+    if (run_double_with_lazy_full_cache) {
+        std::cout << "[Testing uniformly randomly generated binary64 inputs (lazy full cache)...]\n";
+        success &= uniform_random_test<double>(
+            number_of_uniform_random_tests_double, [](auto x, char* buffer) {
+                jkj::dragonbox::to_chars(x, buffer, jkj::dragonbox::policy::cache::lazy_full);
+            });
+        std::cout << "Done.\n\n\n";
+    }
+    if (run_double_with_range_cache) {
+        std::cout << "[Testing uniformly randomly generated binary64 inputs (range cache)...]\n";
+        success &= uniform_random_test<double>(
+            number_of_uniform_random_tests_double, [](auto x, char* buffer) {
+                jkj::dragonbox::to_chars(x, buffer,
+                                         jkj::dragonbox::policy::cache::range_t<-12, 12>{});
+            });
+        std::cout << "Done.\n\n\n";
+    }
+    if (run_double_with_exponent_indexed_cache) {
+        std::cout
+            << "[Testing uniformly randomly generated binary64 inputs (exponent-indexed cache)...]\n";
+        success &= uniform_random_test<double>(
+            number_of_uniform_random_tests_double, [](auto x, char* buffer) {
+                jkj::dragonbox::to_chars(x, buffer, jkj::dragonbox::policy::cache::exponent_indexed);
+            });
+        std::cout << "Done.\n\n\n";
+    }
     if (run_simple_double) {
         std::cout << "[Testing uniformly randomly generated binary64 inputs (simplified impl)...]\n";
         success &= uniform_random_test<double>(
@@ -120,6 +191,46 @@ int main() {
         std::cout << "Done.\n\n\n";
     }
 
+#ifdef JKJ_DRAGONBOX_TO_CHARS_ISA_DISPATCH
+    // Check every copy the running CPU supports, not only the one selected by the dispatch.
+    constexpr std::size_t number_of_uniform_random_tests_per_isa_level = 1000000;
+    using jkj::dragonbox::detail::isa_level;
+    for (auto level : {isa_level::baseline, isa_level::x86_64_v2, isa_level::x86_64_v3,
+                       isa_level::x86_64_v4}) {
+        static char* (*to_chars_n_binary32)(std::uint_least32_t, char*);
+        static char* (*to_chars_n_binary64)(std::uint_least64_t, char*);
+        to_chars_n_binary32 = jkj::dragonbox::detail::get_isa_variant<
+            jkj::dragonbox::ieee754_binary32, std::uint_least32_t>(level);
+        to_chars_n_binary64 = jkj::dragonbox::detail::get_isa_variant<
+            jkj::dragonbox::ieee754_binary64, std::uint_least64_t>(level);
+        if (!to_chars_n_binary32 || !to_chars_n_binary64) {
+            continue;
+        }
+
+        std::cout << "[Testing uniformly randomly generated binary32 inputs (ISA level "
+                  << int(level) << ")...]\n";
+        success &= uniform_random_test<float>(
+            number_of_uniform_random_tests_per_isa_level, [](auto x, char* buffer) {
+                *to_chars_n_binary32(
+                    jkj::dragonbox::default_float_bit_carrier_conversion_traits<
+                        float>::float_to_carrier(x),
+                    buffer) = '\0';
+            });
+        std::cout << "Done.\n\n\n";
+
+        std::cout << "[Testing uniformly randomly generated binary64 inputs (ISA level "
+                  << int(level) << ")...]\n";
+        success &= uniform_random_test<double>(
+            number_of_uniform_random_tests_per_isa_level, [](auto x, char* buffer) {
+                *to_chars_n_binary64(
+                    jkj::dragonbox::default_float_bit_carrier_conversion_traits<
+                        double>::float_to_carrier(x),
+                    buffer) = '\0';
+            });
+        std::cout << "Done.\n\n\n";
+    }
+#endif
+
     if (!success) {
         return -1;
     }
@@ -313,6 +313,80 @@ static bool analyze(std::ostream& out, std::size_t cache_bits) {
 }
 
 
+// Verifies the binary32 cache entries derived from the binary64 table by
+// policy::cache::shared_t. Each derived entry is the ceiling of the upper 64 bits of a binary64
+// entry, which is never below the ceiling of phi_k / 2^Q, so only the upper bounds need to be
+// checked: the margin for the multiplication is at least 7.60 (see verify_compressed_cache), and
+// for the case b <= n_max the integer checks require
+// (derived_cache) < 2^(Q-beta) * a/b + 2^(q-beta)/(floor(nmax/b) * b).
+template <class Binary64CachePolicy>
+static bool verify_shared_cache(char const* policy_name) {
+    std::cout << "[Verifying binary32 cache derived from " << policy_name << "...]\n";
+
+    using format = jkj::dragonbox::ieee754_binary32;
+    using format_traits = jkj::dragonbox::ieee754_binary_traits<format, std::uint_least32_t>;
+    using impl = jkj::dragonbox::detail::impl<format_traits>;
+    using jkj::dragonbox::detail::log::floor_log10_pow2;
+    using jkj::dragonbox::detail::log::floor_log2_pow10;
+    constexpr int cache_bits = 64;
+
+    jkj::unsigned_rational<jkj::big_uint> unit;
+    auto const n_max = jkj::big_uint::power_of_2(format::significand_bits + 2);
+    int max_diff = 0;
+    for (int e = format::min_exponent - format::significand_bits;
+         e <= format::max_exponent - format::significand_bits; ++e) {
+        int const k = impl::kappa - floor_log10_pow2(e);
+        int const beta = e + floor_log2_pow10(k);
+
+        jkj::big_uint const derived_cache{
+            jkj::dragonbox::policy::cache::shared_t<Binary64CachePolicy>{}
+                .template get_cache<format, int>(k)};
+        jkj::big_uint const real_cache{jkj::dragonbox::policy::cache::full.get_cache<format, int>(k)};
+        if (derived_cache < real_cache) {
+            std::cout << "The derived cache is too small. (e = " << e << ")\n\n";
+            return false;
+        }
+        auto const diff = derived_cache - real_cache;
+        if (diff == 0) {
+            continue;
+        }
+        if (diff > 7) {
+            std::cout << "Multiplication is no longer valid. (e = " << e << ")\n\n";
+            return false;
+        }
+        max_diff = std::max(max_diff, int(diff[0]));
+
+        // unit = 2^(e + k - 1) * 5^k = a/b.
+        unit.numerator = 1;
+        unit.denominator = 1;
+        if (k >= 0) {
+            unit.numerator = jkj::big_uint::pow(5, k);
+        }
+        else {
+            unit.denominator = jkj::big_uint::pow(5, -k);
+        }
+        if (e + k - 1 >= 0) {
+            unit.numerator *= jkj::big_uint::power_of_2(e + k - 1);
+        }
+        else {
+            unit.denominator *= jkj::big_uint::power_of_2(-e - k + 1);
+        }
+
+        if (unit.denominator <= n_max) {
+            auto const left_hand_side = unit.denominator * derived_cache -
+                                        jkj::big_uint::power_of_2(cache_bits - beta) * unit.numerator;
+            if (left_hand_side * (n_max / unit.denominator) >=
+                jkj::big_uint::power_of_2(format_traits::carrier_bits - beta)) {
+                std::cout << "Integer check is no longer valid. (e = " << e << ")\n\n";
+                return false;
+            }
+        }
+    }
+
+    std::cout << "Verified. The derived cache exceeds the exact one by at most " << max_diff
+              << ".\n\n";
+    return true;
+}
 
 int main() {
     bool success = true;
@@ -334,5 +408,9 @@ int main() {
     }
     out.close();
 
+    success &= verify_shared_cache<jkj::dragonbox::policy::cache::full_t>("full binary64 cache");
+    success &=
+        verify_shared_cache<jkj::dragonbox::policy::cache::compact_t>("compressed binary64 cache");
+
     return success ? 0 : -1;
 }
\ No newline at end of file
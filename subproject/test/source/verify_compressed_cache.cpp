@@ -22,6 +22,7 @@
 #include <fstream>
 #include <iomanip>
 #include <iostream>
+#include <utility>
 #include <vector>
 
 // We are trying to verify that an appropriate right-shift of phi_k * 5^a plus one
@@ -49,11 +50,11 @@ struct recovered_cache_t {
     bool success;
 };
 
-template <class FormatTraits, class GetCache, class ConvertToBigUInt>
+template <class FormatTraits, int compression_ratio, class GetCache, class ConvertToBigUInt>
 bool verify_compressed_cache(GetCache&& get_cache, ConvertToBigUInt&& convert_to_big_uint,
                              std::size_t max_diff_for_multiplication) {
     using format = typename FormatTraits::format;
-    using cache_holder_type = jkj::dragonbox::compressed_cache_holder<format>;
+    using cache_holder_type = jkj::dragonbox::compressed_cache_holder<format, compression_ratio>;
     using impl = jkj::dragonbox::detail::impl<FormatTraits>;
 
     jkj::unsigned_rational<jkj::big_uint> unit;
@@ -110,7 +111,9 @@ bool verify_compressed_cache(GetCache&& get_cache, ConvertToBigUInt&& convert_to
                     std::cout << "Integer check is no longer valid. (e = " << e << ")\n";
 
                     // This exceptional case is carefully examined, so okay.
-                    if (std::is_same<format, jkj::dragonbox::ieee754_binary32>::value && e == -10) {
+                    if (std::is_same<cache_holder_type, jkj::dragonbox::compressed_cache_holder<
+                                                            jkj::dragonbox::ieee754_binary32>>::value &&
+                        e == -10) {
                         // The exceptional case only occurs when n is exactly n_max.
                         if (left_hand_side * ((n_max - 1) / unit.denominator) >=
                             jkj::big_uint::power_of_2(FormatTraits::carrier_bits - beta)) {
@@ -129,99 +132,106 @@ bool verify_compressed_cache(GetCache&& get_cache, ConvertToBigUInt&& convert_to
     return true;
 }
 
-int main() {
-    bool success = true;
+template <int compression_ratio>
+bool verify_binary32() {
+    std::cout << "[Verifying compressed cache for binary32 with compression ratio "
+              << compression_ratio << "...]\n";
+
+    using cache_holder_type =
+        jkj::dragonbox::compressed_cache_holder<jkj::dragonbox::ieee754_binary32, compression_ratio>;
+    using cache_entry_type = typename cache_holder_type::cache_entry_type;
+
+    if (verify_compressed_cache<jkj::dragonbox::ieee754_binary_traits<
+                                    jkj::dragonbox::ieee754_binary32, std::uint_least32_t>,
+                                compression_ratio>(
+            [](int k) {
+                return recovered_cache_t<cache_entry_type>{
+                    cache_holder_type::template get_cache<int>(k), true};
+            },
+            [](cache_entry_type value) { return jkj::big_uint{value}; }, 7)) {
+        std::cout << "Verification succeeded. No error detected.\n\n";
+        return true;
+    }
+    else {
+        std::cout << "\n";
+        return false;
+    }
+}
 
-    std::cout << "[Verifying compressed cache for binary32...]\n";
-    {
-        using cache_holder_type =
-            jkj::dragonbox::compressed_cache_holder<jkj::dragonbox::ieee754_binary32>;
-
-        if (verify_compressed_cache<jkj::dragonbox::ieee754_binary_traits<
-                jkj::dragonbox::ieee754_binary32, std::uint_least32_t>>(
-                [](int k) {
-                    return recovered_cache_t<cache_holder_type::cache_entry_type>{
-                        cache_holder_type::get_cache<int>(k), true};
-                },
-                [](cache_holder_type::cache_entry_type value) { return jkj::big_uint{value}; }, 7)) {
-            std::cout << "Verification succeeded. No error detected.\n\n";
-        }
-        else {
-            std::cout << "\n";
-            success = false;
-        }
+template <int compression_ratio>
+bool verify_binary64() {
+    std::cout << "[Verifying compressed cache for binary64 with compression ratio "
+              << compression_ratio << "...]\n";
+
+    using cache_holder_type =
+        jkj::dragonbox::compressed_cache_holder<jkj::dragonbox::ieee754_binary64, compression_ratio>;
+    using cache_entry_type = typename cache_holder_type::cache_entry_type;
+
+    if (verify_compressed_cache<jkj::dragonbox::ieee754_binary_traits<
+                                    jkj::dragonbox::ieee754_binary64, std::uint_least64_t>,
+                                compression_ratio>(
+            [](int k) {
+                auto const recovered_cache = cache_holder_type::template get_cache<int>(k);
+
+                // Unless k is one of the exponents stored in the table, get_cache takes the ceiling
+                // by adding 1 to the lower half without carrying it into the upper half, so the
+                // lower half wraps around to zero if the carry is needed.
+                if ((k - cache_holder_type::min_k) % cache_holder_type::compression_ratio != 0 &&
+                    recovered_cache.low() == 0) {
+                    std::cout << "Overflow detected - taking the ceil requires addition-with-carry";
+                    return recovered_cache_t<cache_entry_type>{recovered_cache, false};
+                }
+                else {
+                    return recovered_cache_t<cache_entry_type>{recovered_cache, true};
+                }
+            },
+            [](cache_entry_type value) { return jkj::big_uint{value.low(), value.high()}; }, 13)) {
+        std::cout << "Verification succeeded. No error detected.\n\n";
+        return true;
     }
+    else {
+        std::cout << "\n";
+        return false;
+    }
+}
 
-    std::cout << "[Verifying compressed cache for binary64...]\n";
-    {
-        using cache_holder_type =
-            jkj::dragonbox::compressed_cache_holder<jkj::dragonbox::ieee754_binary64>;
-
-        if (verify_compressed_cache<jkj::dragonbox::ieee754_binary_traits<
-                jkj::dragonbox::ieee754_binary64, std::uint_least64_t>>(
-                [](int k) {
-                    // Compute the base index.
-                    auto const cache_index = int(std::uint_least32_t(k - cache_holder_type::min_k) /
-                                                 cache_holder_type::compression_ratio);
-                    auto const kb =
-                        cache_index * cache_holder_type::compression_ratio + cache_holder_type::min_k;
-                    auto const offset = k - kb;
-
-                    // Get the base cache.
-                    auto const base_cache = cache_holder_type::cache[cache_index];
-
-                    if (offset != 0) {
-                        // Obtain the corresponding power of 5.
-                        auto const pow5 = cache_holder_type::pow5_table[offset];
-
-                        // Compute the required amount of bit-shifts.
-                        using jkj::dragonbox::detail::log::floor_log2_pow5;
-                        auto const alpha = floor_log2_pow5(k) - floor_log2_pow5(kb);
-                        assert(alpha > 0 && alpha < 64);
-
-                        // Try to recover the real cache.
-                        using jkj::dragonbox::detail::wuint::umul128;
-                        auto recovered_cache = umul128(base_cache.high(), pow5);
-                        auto const middle_low = umul128(base_cache.low(), pow5);
-
-                        recovered_cache += middle_low.high();
-
-                        auto const high_to_middle = std::uint_least64_t(
-                            (recovered_cache.high() << (64 - alpha)) & UINT64_C(0xffffffffffffffff));
-                        auto const middle_to_low = std::uint_least64_t(
-                            (recovered_cache.low() << (64 - alpha)) & UINT64_C(0xffffffffffffffff));
-
-                        recovered_cache = {(recovered_cache.low() >> alpha) | high_to_middle,
-                                           ((middle_low.low() >> alpha) | middle_to_low)};
-                        recovered_cache = {recovered_cache.high(),
-                                           std::uint_least64_t(recovered_cache.low() + 1)};
-
-                        if (recovered_cache.low() == 0) {
-                            std::cout
-                                << "Overflow detected - taking the ceil requires addition-with-carry";
-                            return recovered_cache_t<cache_holder_type::cache_entry_type>{
-                                recovered_cache, false};
-                        }
-                        else {
-                            return recovered_cache_t<cache_holder_type::cache_entry_type>{
-                                recovered_cache, true};
-                        }
-                    }
-                    else {
-                        return recovered_cache_t<cache_holder_type::cache_entry_type>{base_cache, true};
-                    }
-                },
-                [](cache_holder_type::cache_entry_type value) {
-                    return jkj::big_uint{value.low(), value.high()};
-                },
-                13)) {
-            std::cout << "Verification succeeded. No error detected.\n\n";
-        }
-        else {
-            std::cout << "\n";
-            success = false;
-        }
+// Verify all compression ratios allowed by compressed_cache_holder.
+using binary32_traits = jkj::dragonbox::compressed_cache_traits<jkj::dragonbox::ieee754_binary32>;
+using binary64_traits = jkj::dragonbox::compressed_cache_traits<jkj::dragonbox::ieee754_binary64>;
+
+template <int compression_ratio>
+bool verify_binary32_if_valid() {
+    if constexpr (binary32_traits::is_valid_compression_ratio(compression_ratio)) {
+        return verify_binary32<compression_ratio>();
+    }
+    return true;
+}
+
+template <int compression_ratio>
+bool verify_binary64_if_valid() {
+    if constexpr (binary64_traits::is_valid_compression_ratio(compression_ratio)) {
+        return verify_binary64<compression_ratio>();
     }
+    return true;
+}
+
+template <int... ratios_minus_one>
+bool verify_all_binary32(std::integer_sequence<int, ratios_minus_one...>) {
+    return (verify_binary32_if_valid<ratios_minus_one + 1>() & ...);
+}
+
+template <int... ratios_minus_one>
+bool verify_all_binary64(std::integer_sequence<int, ratios_minus_one...>) {
+    return (verify_binary64_if_valid<ratios_minus_one + 1>() & ...);
+}
+
+int main() {
+    bool success = true;
+
+    success &= verify_all_binary32(
+        std::make_integer_sequence<int, binary32_traits::max_compression_ratio>{});
+    success &= verify_all_binary64(
+        std::make_integer_sequence<int, binary64_traits::max_compression_ratio>{});
 
     std::cout << "Done.\n\n\n";
     return success ? 0 : -1;
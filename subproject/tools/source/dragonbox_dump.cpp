@@ -0,0 +1,568 @@
+// Copyright 2025 Junekey Jeon
+//
+// The contents of this file may be used under the terms of
+// the Apache License v2.0 with LLVM Exceptions.
+//
+//    (See accompanying file LICENSE-Apache or copy at
+//     https://llvm.org/foundation/relicensing/LICENSE.txt)
+//
+// Alternatively, the contents of this file may be used under the terms of
+// the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE-Boost or copy at
+//     https://www.boost.org/LICENSE_1_0.txt)
+//
+// Unless required by applicable law or agreed to in writing, this software
+// is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.
+
+// Converts a raw dump of float's or double's into text with jkj::dragonbox::to_chars_n. The input
+// is mapped into memory and cut into chunks of values, which worker threads format into buffers of
+// their own, and the main thread writes the buffers out in the order of the chunks, so the output
+// does not depend on the number of threads. Values in a row are separated by the delimiter, and
+// each row, including the last one even if it is short, ends with a newline. The throughput is
+// reported to stderr at the end.
+//
+// Usage: dragonbox_dump [--type f32|f64] [--delimiter C] [--row-width N]
+//                       [--endian native|little|big] [--threads T] [--chunk N] [--direct]
+//                       INPUT [OUTPUT]
+//
+// The defaults are f64, ',', 1, native, the number of hardware threads, and 131072 values per
+// chunk. Without OUTPUT or with "-", the text goes to stdout. --direct opens OUTPUT with O_DIRECT
+// (where available), so that the text does not fill the page cache; it is then written in blocks
+// of 8 MB.
+
+#include "dragonbox/dragonbox_to_chars.h"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+#if defined(__unix__) || defined(__APPLE__)
+    #include <cerrno>
+    #include <fcntl.h>
+    #include <sys/mman.h>
+    #include <sys/stat.h>
+    #include <unistd.h>
+    #define JKJ_DRAGONBOX_DUMP_HAS_POSIX 1
+#else
+    #define JKJ_DRAGONBOX_DUMP_HAS_POSIX 0
+#endif
+
+#if JKJ_DRAGONBOX_DUMP_HAS_POSIX && defined(O_DIRECT)
+    #define JKJ_DRAGONBOX_DUMP_HAS_O_DIRECT 1
+#else
+    #define JKJ_DRAGONBOX_DUMP_HAS_O_DIRECT 0
+#endif
+
+// Read-only view of a file's contents, mapped into memory when possible.
+class mapped_file {
+public:
+    explicit mapped_file(char const* path) {
+#if JKJ_DRAGONBOX_DUMP_HAS_POSIX
+        int fd = ::open(path, O_RDONLY);
+        if (fd < 0) {
+            return;
+        }
+        struct stat st;
+        if (::fstat(fd, &st) == 0) {
+            if (st.st_size == 0) {
+                is_open_ = true;
+            }
+            else {
+                auto ptr = ::mmap(nullptr, std::size_t(st.st_size), PROT_READ, MAP_PRIVATE, fd, 0);
+                if (ptr != MAP_FAILED) {
+    #ifdef MADV_SEQUENTIAL
+                    ::madvise(ptr, std::size_t(st.st_size), MADV_SEQUENTIAL);
+    #endif
+                    data_ = static_cast<unsigned char const*>(ptr);
+                    size_ = std::size_t(st.st_size);
+                    mapped_ = true;
+                    is_open_ = true;
+                }
+            }
+        }
+        ::close(fd);
+        if (is_open_) {
+            return;
+        }
+#endif
+        std::ifstream in{path, std::ios::binary};
+        if (in) {
+            storage_.assign(std::istreambuf_iterator<char>{in}, std::istreambuf_iterator<char>{});
+            data_ = reinterpret_cast<unsigned char const*>(storage_.data());
+            size_ = storage_.size();
+            is_open_ = true;
+        }
+    }
+
+    mapped_file(mapped_file const&) = delete;
+    mapped_file& operator=(mapped_file const&) = delete;
+
+    ~mapped_file() {
+#if JKJ_DRAGONBOX_DUMP_HAS_POSIX
+        if (mapped_) {
+            ::munmap(const_cast<unsigned char*>(data_), size_);
+        }
+#endif
+    }
+
+    bool is_open() const noexcept { return is_open_; }
+    unsigned char const* data() const noexcept { return data_; }
+    std::size_t size() const noexcept { return size_; }
+
+private:
+    unsigned char const* data_ = nullptr;
+    std::size_t size_ = 0;
+    bool mapped_ = false;
+    bool is_open_ = false;
+    std::vector<char> storage_;
+};
+
+// Destination of the text: a file descriptor on POSIX systems, and a FILE otherwise. With
+// O_DIRECT, the text is gathered into an aligned buffer and written out in whole buffers, and the
+// remainder, which is in general not a whole number of blocks, is written after turning O_DIRECT
+// off.
+class output_file {
+public:
+    static constexpr std::size_t direct_alignment = 4096;
+    static constexpr std::size_t direct_buffer_size = std::size_t(1) << 23;
+
+    output_file() = default;
+    output_file(output_file const&) = delete;
+    output_file& operator=(output_file const&) = delete;
+    ~output_file() { close(); }
+
+    // Opens path for writing, or stdout if path is null. Returns false on failure.
+    bool open(char const* path, bool direct) {
+#if JKJ_DRAGONBOX_DUMP_HAS_POSIX
+        if (!path) {
+            fd_ = STDOUT_FILENO;
+            return true;
+        }
+        int flags = O_WRONLY | O_CREAT | O_TRUNC;
+    #if JKJ_DRAGONBOX_DUMP_HAS_O_DIRECT
+        if (direct) {
+            void* ptr;
+            if (::posix_memalign(&ptr, direct_alignment, direct_buffer_size) != 0) {
+                return false;
+            }
+            direct_buffer_.reset(static_cast<char*>(ptr));
+            flags |= O_DIRECT;
+        }
+    #else
+        (void)direct;
+    #endif
+        fd_ = ::open(path, flags, 0666);
+        owns_fd_ = true;
+        return fd_ >= 0;
+#else
+        (void)direct;
+        file_ = path ? std::fopen(path, "wb") : stdout;
+        return file_ != nullptr;
+#endif
+    }
+
+    bool write(char const* data, std::size_t size) {
+        if (!direct_buffer_) {
+            return write_through(data, size);
+        }
+        while (size != 0) {
+            auto const n = std::min(size, direct_buffer_size - direct_buffer_used_);
+            std::memcpy(direct_buffer_.get() + direct_buffer_used_, data, n);
+            direct_buffer_used_ += n;
+            data += n;
+            size -= n;
+            if (direct_buffer_used_ == direct_buffer_size) {
+                if (!write_through(direct_buffer_.get(), direct_buffer_size)) {
+                    return false;
+                }
+                direct_buffer_used_ = 0;
+            }
+        }
+        return true;
+    }
+
+    // Writes out what is left and closes the file. Returns false on failure.
+    bool close() {
+        bool success = true;
+#if JKJ_DRAGONBOX_DUMP_HAS_POSIX
+        if (fd_ < 0) {
+            return true;
+        }
+    #if JKJ_DRAGONBOX_DUMP_HAS_O_DIRECT
+        if (direct_buffer_used_ != 0) {
+            auto const flags = ::fcntl(fd_, F_GETFL);
+            success = flags != -1 && ::fcntl(fd_, F_SETFL, flags & ~O_DIRECT) != -1 &&
+                      write_through(direct_buffer_.get(), direct_buffer_used_);
+            direct_buffer_used_ = 0;
+        }
+    #endif
+        if (owns_fd_) {
+            success &= ::close(fd_) == 0;
+        }
+        fd_ = -1;
+#else
+        if (!file_) {
+            return true;
+        }
+        success = std::fflush(file_) == 0;
+        if (file_ != stdout) {
+            success &= std::fclose(file_) == 0;
+        }
+        file_ = nullptr;
+#endif
+        return success;
+    }
+
+private:
+    bool write_through(char const* data, std::size_t size) {
+#if JKJ_DRAGONBOX_DUMP_HAS_POSIX
+        while (size != 0) {
+            // Some systems reject a single write of 2 GB or more.
+            auto const n = ::write(fd_, data, std::min(size, std::size_t(1) << 30));
+            if (n < 0) {
+                if (errno == EINTR) {
+                    continue;
+                }
+                return false;
+            }
+            data += n;
+            size -= std::size_t(n);
+        }
+        return true;
+#else
+        return std::fwrite(data, 1, size, file_) == size;
+#endif
+    }
+
+    struct free_deleter {
+        void operator()(char* ptr) const noexcept { std::free(ptr); }
+    };
+
+#if JKJ_DRAGONBOX_DUMP_HAS_POSIX
+    int fd_ = -1;
+    bool owns_fd_ = false;
+#else
+    std::FILE* file_ = nullptr;
+#endif
+    std::unique_ptr<char, free_deleter> direct_buffer_;
+    std::size_t direct_buffer_used_ = 0;
+};
+
+struct dump_options {
+    char delimiter = ',';
+    std::size_t row_width = 1;
+    bool swap_bytes = false;
+    unsigned int thread_count = 1;
+    std::size_t chunk_size = std::size_t(1) << 17;
+};
+
+template <class UInt>
+static UInt byteswap(UInt x) noexcept {
+    UInt result = 0;
+    for (std::size_t idx = 0; idx < sizeof(UInt); ++idx) {
+        result = UInt((result << 8) | (x & 0xff));
+        x >>= 8;
+    }
+    return result;
+}
+
+// Formats count values stored from input on, each followed by the delimiter or, at the end of a
+// row, a newline. A chunk always starts at the beginning of a row, and if it ends in the middle
+// of one, the last delimiter is replaced by a newline.
+template <class Float>
+static char* format_chunk(unsigned char const* input, std::size_t count,
+                          dump_options const& options, char* buffer) noexcept {
+    using carrier_uint =
+        typename jkj::dragonbox::default_float_bit_carrier_conversion_traits<Float>::carrier_uint;
+
+    std::size_t column = 0;
+    for (std::size_t idx = 0; idx < count; ++idx) {
+        carrier_uint bits;
+        std::memcpy(&bits, input + idx * sizeof(Float), sizeof(Float));
+        if (options.swap_bytes) {
+            bits = byteswap(bits);
+        }
+        Float x;
+        std::memcpy(&x, &bits, sizeof(Float));
+
+        buffer = jkj::dragonbox::to_chars_n(x, buffer);
+        if (++column == options.row_width) {
+            *buffer++ = '\n';
+            column = 0;
+        }
+        else {
+            *buffer++ = options.delimiter;
+        }
+    }
+    if (column != 0) {
+        buffer[-1] = '\n';
+    }
+    return buffer;
+}
+
+// Formats number_of_values values stored from input on and writes the text into out. Each
+// worker thread takes the next chunk, waits until the slot it maps to has been written out, and
+// formats the chunk into the slot; the calling thread writes the slots out in order. Adds the
+// number of bytes written to output_bytes, and returns false if a write failed.
+template <class Float>
+static bool dump(unsigned char const* input, std::size_t number_of_values,
+                 dump_options const& options, output_file& out, std::size_t& output_bytes) {
+    constexpr auto max_length = jkj::dragonbox::max_output_string_length<
+        typename jkj::dragonbox::default_float_bit_carrier_conversion_traits<Float>::format>;
+
+    auto const chunk_size = options.chunk_size;
+    auto const chunk_count = (number_of_values + chunk_size - 1) / chunk_size;
+    if (chunk_count == 0) {
+        return true;
+    }
+
+    // Two slots per thread, so that a thread can format a chunk while its previous one is
+    // waiting to be written.
+    struct slot {
+        std::unique_ptr<char[]> buffer;
+        std::size_t length = 0;
+        std::size_t chunk = std::numeric_limits<std::size_t>::max();
+    };
+    std::vector<slot> slots(std::min(std::size_t(options.thread_count) * 2, chunk_count));
+    for (auto& s : slots) {
+        s.buffer.reset(new char[chunk_size * (max_length + 1)]);
+    }
+
+    std::mutex mutex;
+    std::condition_variable cv;
+    std::size_t written_chunks = 0;
+    bool failed = false;
+    std::atomic<std::size_t> next_chunk{0};
+
+    auto work = [&] {
+        while (true) {
+            auto const chunk = next_chunk.fetch_add(1, std::memory_order_relaxed);
+            if (chunk >= chunk_count) {
+                return;
+            }
+            auto& s = slots[chunk % slots.size()];
+            {
+                std::unique_lock<std::mutex> lock{mutex};
+                cv.wait(lock, [&] { return failed || written_chunks + slots.size() > chunk; });
+                if (failed) {
+                    return;
+                }
+            }
+
+            auto const first = chunk * chunk_size;
+            auto const count = std::min(chunk_size, number_of_values - first);
+            auto const end =
+                format_chunk<Float>(input + first * sizeof(Float), count, options, s.buffer.get());
+            {
+                std::lock_guard<std::mutex> lock{mutex};
+                s.length = std::size_t(end - s.buffer.get());
+                s.chunk = chunk;
+            }
+            cv.notify_all();
+        }
+    };
+
+    std::vector<std::thread> threads;
+    threads.reserve(options.thread_count);
+    for (unsigned int idx = 0; idx < options.thread_count; ++idx) {
+        threads.emplace_back(work);
+    }
+
+    bool success = true;
+    for (std::size_t chunk = 0; chunk < chunk_count; ++chunk) {
+        auto& s = slots[chunk % slots.size()];
+        {
+            std::unique_lock<std::mutex> lock{mutex};
+            cv.wait(lock, [&] { return s.chunk == chunk; });
+        }
+        if (!out.write(s.buffer.get(), s.length)) {
+            success = false;
+            break;
+        }
+        output_bytes += s.length;
+        {
+            std::lock_guard<std::mutex> lock{mutex};
+            ++written_chunks;
+        }
+        cv.notify_all();
+    }
+    if (!success) {
+        {
+            std::lock_guard<std::mutex> lock{mutex};
+            failed = true;
+        }
+        cv.notify_all();
+    }
+
+    for (auto& t : threads) {
+        t.join();
+    }
+    return success;
+}
+
+static bool is_native_little_endian() noexcept {
+    std::uint_least16_t const one = 1;
+    unsigned char first_byte;
+    std::memcpy(&first_byte, &one, 1);
+    return first_byte == 1;
+}
+
+static void print_usage(char const* program_name) {
+    std::cerr << "Usage: " << program_name
+              << " [--type f32|f64] [--delimiter C] [--row-width N] [--endian native|little|big]"
+                 " [--threads T] [--chunk N] [--direct] INPUT [OUTPUT]\n";
+}
+
+int main(int argc, char** argv) {
+    std::string_view type = "f64";
+    std::string_view endian = "native";
+    std::string_view delimiter = ",";
+    bool direct = false;
+    char const* input_path = nullptr;
+    char const* output_path = nullptr;
+    dump_options options;
+    options.thread_count = std::max(1u, std::thread::hardware_concurrency());
+
+    for (int i = 1; i < argc; ++i) {
+        std::string_view arg = argv[i];
+        if (arg == "--direct") {
+            direct = true;
+            continue;
+        }
+        if (arg.size() > 2 && arg.substr(0, 2) == "--") {
+            if (i + 1 == argc) {
+                std::cerr << "Missing value for " << arg << "\n";
+                return -1;
+            }
+            if (arg == "--type") {
+                type = argv[++i];
+            }
+            else if (arg == "--delimiter") {
+                delimiter = argv[++i];
+            }
+            else if (arg == "--row-width") {
+                options.row_width = std::strtoull(argv[++i], nullptr, 10);
+            }
+            else if (arg == "--endian") {
+                endian = argv[++i];
+            }
+            else if (arg == "--threads") {
+                options.thread_count = unsigned(std::strtoul(argv[++i], nullptr, 10));
+            }
+            else if (arg == "--chunk") {
+                options.chunk_size = std::strtoull(argv[++i], nullptr, 10);
+            }
+            else {
+                std::cerr << "Unknown option " << arg << "\n";
+                print_usage(argv[0]);
+                return -1;
+            }
+        }
+        else if (!input_path) {
+            input_path = argv[i];
+        }
+        else if (!output_path) {
+            output_path = argv[i];
+        }
+        else {
+            print_usage(argv[0]);
+            return -1;
+        }
+    }
+
+    if (!input_path) {
+        print_usage(argv[0]);
+        return -1;
+    }
+    if (output_path && std::string_view(output_path) == "-") {
+        output_path = nullptr;
+    }
+    if (type != "f32" && type != "f64") {
+        std::cerr << "--type must be either f32 or f64.\n";
+        return -1;
+    }
+    if (delimiter == "\\t") {
+        delimiter = "\t";
+    }
+    if (delimiter.size() != 1) {
+        std::cerr << "--delimiter must be a single character or \\t.\n";
+        return -1;
+    }
+    options.delimiter = delimiter[0];
+    if (endian == "little" || endian == "big") {
+        options.swap_bytes = (endian == "little") != is_native_little_endian();
+    }
+    else if (endian != "native") {
+        std::cerr << "--endian must be one of native, little and big.\n";
+        return -1;
+    }
+    if (options.row_width == 0 || options.thread_count == 0 || options.chunk_size == 0) {
+        std::cerr << "--row-width, --threads and --chunk must be positive.\n";
+        return -1;
+    }
+    // Make every chunk start at the beginning of a row.
+    options.chunk_size = std::max(options.chunk_size / options.row_width, std::size_t(1)) *
+                         options.row_width;
+    if (direct && !JKJ_DRAGONBOX_DUMP_HAS_O_DIRECT) {
+        std::cerr << "--direct is not supported on this system.\n";
+        return -1;
+    }
+    if (direct && !output_path) {
+        std::cerr << "--direct requires OUTPUT.\n";
+        return -1;
+    }
+
+    auto const from = std::chrono::steady_clock::now();
+
+    mapped_file input{input_path};
+    if (!input.is_open()) {
+        std::cerr << "Failed to read " << input_path << "\n";
+        return -1;
+    }
+    auto const value_size = type == "f32" ? sizeof(float) : sizeof(double);
+    if (input.size() % value_size != 0) {
+        std::cerr << "The size of " << input_path << " is not a multiple of " << value_size
+                  << " bytes.\n";
+        return -1;
+    }
+    auto const number_of_values = input.size() / value_size;
+
+    output_file out;
+    if (!out.open(output_path, direct)) {
+        std::cerr << "Failed to open " << output_path << "\n";
+        return -1;
+    }
+
+    std::size_t output_bytes = 0;
+    auto success = type == "f32"
+                       ? dump<float>(input.data(), number_of_values, options, out, output_bytes)
+                       : dump<double>(input.data(), number_of_values, options, out, output_bytes);
+    success &= out.close();
+    if (!success) {
+        std::cerr << "Failed to write " << (output_path ? output_path : "to stdout") << "\n";
+        return -1;
+    }
+
+    auto const seconds =
+        std::chrono::duration<double>(std::chrono::steady_clock::now() - from).count();
+    std::cerr << number_of_values << " values, " << input.size() << " bytes in, " << output_bytes
+              << " bytes out, " << std::fixed << std::setprecision(3) << seconds << " s, "
+              << double(input.size()) / seconds / 1e9 << " GB/s in, "
+              << double(output_bytes) / seconds / 1e9 << " GB/s out\n";
+}